@@ -11,17 +11,29 @@
  * @version 1.0
  * 
  * Features:
- * - Automatic height balancing after insertions
- * - Four types of tree traversals
- * - Successor finding functionality
+ * - Automatic height balancing after insertions and deletions
+ * - Four types of tree traversals, plus visitor traversals with early exit
+ * - Successor and predecessor finding functionality
+ * - Bidirectional iterators (begin/end, rbegin/rend, const variants)
+ * - Iterative lookups (find, contains, lower_bound, upper_bound, equal_range)
  * - Parent pointer maintenance for efficient navigation
+ * - Slab node storage (Node_Arena) with block-at-a-time teardown
+ * - Linear-time bulk construction from sorted ranges and batch merging
+ * - Optional order-statistic augmentation (rank, select, count_range) as a policy
+ * - Optional monoid augmentation for O(log n) range aggregates as a policy
+ * - O(log n) join and split, and parallel divide-and-conquer union, intersection
+ *   and difference built on them
  * - Template-based implementation for any comparable data type
  * 
  * Time Complexity:
- * - Insertion: O(log n)
+ * - Insertion: O(log n), iterative with early-stopping retracing
+ * - Deletion: O(log n)
  * - Search: O(log n)
  * - Traversal: O(n)
  * - Successor finding: O(log n)
+ * - Join, split: O(log n)
+ * - Union, intersection, difference of sizes m <= n: O(m log(n/m + 1)) work,
+ *   O(log^2 n) span, plus O(1) per discarded node
  * 
  * Space Complexity: O(n)
  * 
@@ -34,6 +46,14 @@
 #ifndef BINARY_TREE_HPP
 #define BINARY_TREE_HPP
 
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+#include "Node_Arena.hpp"
+#include "Tree_Augment.hpp"
+
 /**
  * @brief AVL Self-Balancing Binary Search Tree
  * 
@@ -42,18 +62,23 @@
  * tree operations.
  * 
  * @tparam T The data type stored in the tree nodes. Must support comparison operators.
+ * @tparam Augment Policy adding per-node data kept up to date through every change
+ *                 (No_Augment, Order_Statistics, Monoid_Augment); see Tree_Augment.hpp
  */
-template<class T>
+template<class T, class Augment = No_Augment>
 class Binary_Tree {
 private:
+    using Augment_Data = typename Augment::template Node_Data<T>;  ///< Per-node data added by the policy
+
     /**
      * @brief Internal node structure for the AVL tree
      * 
      * Each node contains the data, pointers to left and right children,
      * a parent pointer for efficient navigation, and height information
-     * for balancing calculations.
+     * for balancing calculations. Data added by the augmentation policy is
+     * inherited, so an empty policy adds no bytes.
      */
-    struct Node {
+    struct Node : Augment_Data {
         T data;           ///< The data stored in this node
         Node* left;       ///< Pointer to left child (nullptr if no left child)
         Node* right;      ///< Pointer to right child (nullptr if no right child)
@@ -61,13 +86,29 @@ private:
         int height;       ///< Height of the subtree rooted at this node
 
         /**
-         * @brief Constructs a new node with the given data
-         * @param data The data to store in the node
+         * @brief Constructs a new node, building its data in place
+         * @param args Arguments forwarded to the constructor of T
          */
-        explicit Node(T data);
+        template<class... Args>
+        explicit Node(Args&&... args);
     };
     
+    static constexpr unsigned long long UNKNOWN_SIZE = ~0ULL;  ///< Marks a size to be counted on demand
+    static constexpr int PARALLEL_HEIGHT = 12;  ///< Smallest subtree height worth handing to another thread
+
+    /**
+     * @brief Bookkeeping of one branch of a set operation
+     * 
+     * Every concurrently running branch owns one, so nothing is shared between threads.
+     */
+    struct Merge_State {
+        std::vector<Node*> discarded;  ///< Roots of subtrees left out of the result
+        unsigned long long matched = 0;  ///< Number of keys found in both trees
+    };
+
     Node* root;  ///< Pointer to the root node of the tree (nullptr if tree is empty)
+    Node_Arena<Node> nodes;  ///< Slab storage owning every node of the tree
+    mutable std::atomic<unsigned long long> count;  ///< Number of keys, or UNKNOWN_SIZE after a split; filled in by get_size()
 
     /**
      * @brief Calculates the height of a node
@@ -98,15 +139,370 @@ private:
     Node* leftRotate(Node* x);
     
     /**
-     * @brief Recursively inserts a new element into the tree
-     * @param ptr Current node in the recursion
-     * @param data Data to insert
-     * @param parent Parent of the current node
-     * @return Pointer to the root of the modified subtree
+     * @brief Inserts a key unless an equivalent one is present, copying or moving it once
+     * @param data The key to insert (const T& or T&&)
+     * @return Pair of the node holding the key and whether it was inserted
+     */
+    template<class K>
+    std::pair<Node*, bool> insertUnique(K&& data);
+
+    /**
+     * @brief Links a new leaf under a parent and rebalances the path above it
+     * @param parent The parent found by the descent (nullptr for an empty tree)
+     * @param node The new leaf
+     * @param asLeft True to link the leaf as the left child of parent
+     */
+    void attach(Node* parent, Node* node, bool asLeft);
+
+    /**
+     * @brief Builds a balanced subtree from the next count distinct keys of a sorted range
+     * @param it Current position in the range; advanced past the consumed keys
+     * @param last End of the range
+     * @param count Number of distinct keys to consume
+     * @return Root of the new subtree (its parent is left unset)
+     */
+    template<class ForwardIt>
+    Node* buildBalanced(ForwardIt& it, ForwardIt last, unsigned long long count);
+
+    /**
+     * @brief Invokes a visitor on an element and reports whether to continue
+     * @param visit The visitor
+     * @param data The element to visit
+     * @return False if the visitor returned false, true otherwise (including void visitors)
+     */
+    template<class Visitor>
+    static bool proceed(Visitor& visit, const T& data);
+
+    /**
+     * @brief Visits a subtree in pre-order using parent pointers instead of a stack
+     * @param top Root of the subtree (can be nullptr)
+     * @param visit The visitor
+     * @return True if every node was visited, false if the visitor stopped early
+     */
+    template<class Visitor>
+    static bool walkPreOrder(Node* top, Visitor&& visit);
+
+    /**
+     * @brief Visits a subtree in order using parent pointers instead of a stack
+     * @param top Root of the subtree (can be nullptr)
+     * @param visit The visitor
+     * @return True if every node was visited, false if the visitor stopped early
+     */
+    template<class Visitor>
+    static bool walkInOrder(Node* top, Visitor&& visit);
+
+    /**
+     * @brief Visits a subtree in post-order using parent pointers instead of a stack
+     * @param top Root of the subtree (can be nullptr)
+     * @param visit The visitor
+     * @return True if every node was visited, false if the visitor stopped early
+     */
+    template<class Visitor>
+    static bool walkPostOrder(Node* top, Visitor&& visit);
+
+    /**
+     * @brief Visits a subtree level by level
+     * @param top Root of the subtree (can be nullptr)
+     * @param visit The visitor
+     * @return True if every node was visited, false if the visitor stopped early
+     */
+    template<class Visitor>
+    static bool walkLevelOrder(Node* top, Visitor&& visit);
+
+    /**
+     * @brief Replaces a child pointer of a node, or the root if the node is nullptr
+     * @param parent Parent whose child pointer to update (nullptr for the root)
+     * @param oldChild The child currently linked under parent
+     * @param newChild The node to link in its place (can be nullptr)
+     */
+    void replaceChild(Node* parent, Node* oldChild, Node* newChild);
+
+    /**
+     * @brief Updates the height of a node and rotates it if it is out of balance
+     * @param ptr The node to rebalance
+     * @return Pointer to the new root of the subtree (not yet linked into the parent)
+     */
+    Node* rebalance(Node* ptr);
+
+    /**
+     * @brief Removes a node from the tree
+     * @param ptr Node to remove
+     * @return Pointer to the successor of the removed node, or nullptr if there is none
+     * @throws std::invalid_argument if ptr is nullptr
+     * 
+     * Nodes are relinked rather than having their data swapped, so iterators to every
+     * other element stay valid.
+     */
+    Node* erase(Node* ptr);
+
+    /**
+     * @brief Restores heights and balance from a node up towards the root
+     * @param ptr The lowest node whose subtree changed
+     * 
+     * Stops as soon as a subtree keeps its previous height.
+     */
+    void retrace(Node* ptr);
+
+    /**
+     * @brief Makes a node the parent of two subtrees and updates its height and policy data
+     * @param node The node to link (its parent is left unchanged)
+     * @param left New left subtree (can be nullptr)
+     * @param right New right subtree (can be nullptr)
+     */
+    static void link(Node* node, Node* left, Node* right);
+
+    /**
+     * @brief Detaches the children of a node
+     * @param node The node to detach
+     * @param left Output: the former left subtree, with no parent
+     * @param right Output: the former right subtree, with no parent
+     */
+    static void detach(Node* node, Node*& left, Node*& right);
+
+    /**
+     * @brief Joins two detached subtrees around a middle node
+     * @param left Subtree whose keys are all less than the middle key (can be nullptr)
+     * @param middle Detached node holding the middle key
+     * @param right Subtree whose keys are all greater than the middle key (can be nullptr)
+     * @return Root of the balanced result, with no parent
+     */
+    Node* joinNodes(Node* left, Node* middle, Node* right);
+
+    /**
+     * @brief Joins along the right spine of a subtree taller than the other by two or more
+     * @param left The taller subtree
+     * @param middle Detached node holding the middle key
+     * @param right The shorter subtree
+     * @return Root of the result (its parent is that of left)
+     */
+    Node* joinRight(Node* left, Node* middle, Node* right);
+
+    /**
+     * @brief Joins along the left spine of a subtree taller than the other by two or more
+     * @param left The shorter subtree
+     * @param middle Detached node holding the middle key
+     * @param right The taller subtree
+     * @return Root of the result (its parent is that of right)
+     */
+    Node* joinLeft(Node* left, Node* middle, Node* right);
+
+    /**
+     * @brief Joins two detached subtrees without a middle node
+     * @param left Subtree whose keys are all less than those of right (can be nullptr)
+     * @param right The other subtree (can be nullptr)
+     * @return Root of the balanced result, with no parent
+     */
+    Node* joinPair(Node* left, Node* right);
+
+    /**
+     * @brief Removes the largest node of a detached subtree
+     * @param top Root of a non-empty subtree
+     * @param last Output: the removed node, detached
+     * @return Root of the remaining subtree, with no parent
+     */
+    Node* splitLast(Node* top, Node*& last);
+
+    /**
+     * @brief Splits a detached subtree around a key
+     * @param top Root of the subtree (can be nullptr)
+     * @param key The key to split at
+     * @param less Output: subtree of the keys less than key, with no parent
+     * @param greater Output: subtree of the keys greater than key, with no parent
+     * @return The detached node holding an equivalent key, or nullptr if there is none
+     */
+    Node* splitNode(Node* top, const T& key, Node*& less, Node*& greater);
+
+    /**
+     * @brief Computes the union of two detached subtrees, keeping the nodes of a on ties
+     * @param a Root of the first subtree
+     * @param b Root of the second subtree
+     * @param state Collects duplicate nodes of b and counts them
+     * @param spawn Remaining levels of recursion allowed to fork onto new threads
+     * @return Root of the result, with no parent
+     */
+    Node* uniteNodes(Node* a, Node* b, Merge_State& state, unsigned spawn);
+
+    /**
+     * @brief Computes the intersection of two detached subtrees, keeping the nodes of a
+     * @param a Root of the first subtree
+     * @param b Root of the second subtree
+     * @param state Collects every node left out and counts the common keys
+     * @param spawn Remaining levels of recursion allowed to fork onto new threads
+     * @return Root of the result, with no parent
+     */
+    Node* intersectNodes(Node* a, Node* b, Merge_State& state, unsigned spawn);
+
+    /**
+     * @brief Removes the keys of one detached subtree from another
+     * @param a Root of the subtree to subtract from
+     * @param b Root of the subtree of keys to remove
+     * @param state Collects every node left out and counts the keys removed from a
+     * @param spawn Remaining levels of recursion allowed to fork onto new threads
+     * @return Root of the result, with no parent
+     */
+    Node* subtractNodes(Node* a, Node* b, Merge_State& state, unsigned spawn);
+
+    /**
+     * @brief Runs the two recursive halves of a set operation, the second on a new thread if allowed
+     * @param parallel True to run the halves concurrently
+     * @param state Bookkeeping of the calling branch; the new thread's is merged into it
+     * @param lower Callable taking Merge_State&, run on the calling thread
+     * @param upper Callable taking Merge_State&
+     * 
+     * Falls back to running both halves on the calling thread if no thread can be started.
+     */
+    template<class Lower, class Upper>
+    static void forkJoin(bool parallel, Merge_State& state, Lower&& lower, Upper&& upper);
+
+    /**
+     * @brief Returns how many levels of a set operation may fork onto new threads
+     * @return About log2 of the hardware thread count plus one, or 0 on a single core
+     */
+    static unsigned fanOut();
+
+    /**
+     * @brief Destroys every node of a detached subtree, returning the slots to the arena
+     * @param top Root of the subtree (can be nullptr)
+     */
+    void destroySubtree(Node* top);
+
+    /**
+     * @brief Destroys the nodes a set operation left out
+     * @param state The bookkeeping of the finished operation
+     */
+    void discard(Merge_State& state);
+
+    /**
+     * @brief Finds the minimum value in the subtree rooted at the given node
+     * @param ptr Root of the subtree to search (can be nullptr)
+     * @return Pointer to the node with minimum value, or nullptr if subtree is empty
+     * 
+     * In a BST, the minimum value is always in the leftmost node
+     */
+    static Node* findMin(Node *ptr);
+    
+    /**
+     * @brief Finds the successor of a given node
+     * @param ptr Node whose successor to find (can be nullptr)
+     * @return Pointer to the successor node, or nullptr if no successor exists
+     * 
+     * The successor is the next larger element in the tree.
+     * If the node has a right child, the successor is the minimum of the right subtree.
+     * Otherwise, it's the first ancestor that is a left child of its parent.
+     */
+    static Node* findSuccessor(Node* ptr);
+
+    /**
+     * @brief Finds the maximum value in the subtree rooted at the given node
+     * @param ptr Root of the subtree to search (can be nullptr)
+     * @return Pointer to the node with maximum value, or nullptr if subtree is empty
+     * 
+     * In a BST, the maximum value is always in the rightmost node
+     */
+    static Node* findMax(Node *ptr);
+
+    /**
+     * @brief Finds the predecessor of a given node
+     * @param ptr Node whose predecessor to find (can be nullptr)
+     * @return Pointer to the predecessor node, or nullptr if no predecessor exists
+     * 
+     * The predecessor is the next smaller element in the tree.
+     * If the node has a left child, the predecessor is the maximum of the left subtree.
+     * Otherwise, it's the first ancestor that is a right child of its parent.
      */
-    Node* insert(Node* ptr, T data, Node* parent);
+    static Node* findPredecessor(Node* ptr);
 
 public:
+    /**
+     * @brief Bidirectional in-order iterator over the tree
+     * 
+     * Steps through parent pointers with findSuccessor/findPredecessor, so a full scan
+     * costs O(1) amortized per step with no auxiliary stack. Elements are read-only,
+     * since changing a key in place would break the ordering. The end iterator holds
+     * nullptr and decrementing it moves to the largest element.
+     */
+    class Iterator {
+    private:
+        Node* curr;              ///< Pointer to the current node (nullptr at end)
+        const Binary_Tree* tree; ///< Pointer to the tree being iterated
+        friend class Binary_Tree;
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        /**
+         * @brief Constructs an iterator for a given node and tree
+         * @param p Pointer to the node (nullptr for end)
+         * @param t Pointer to the tree
+         */
+        Iterator(Node* p, const Binary_Tree* t);
+
+        /**
+         * @brief Default constructor. Creates an end iterator not bound to any tree.
+         */
+        Iterator();
+
+        /**
+         * @brief Checks if two iterators are equal
+         * @param other The iterator to compare with
+         * @return True if both refer to the same node, false otherwise
+         */
+        bool operator==(const Iterator& other) const;
+
+        /**
+         * @brief Checks if two iterators are not equal
+         * @param other The iterator to compare with
+         * @return True if they refer to different nodes, false otherwise
+         */
+        bool operator!=(const Iterator& other) const;
+
+        /**
+         * @brief Dereferences the iterator to access the element
+         * @return Const reference to the element
+         * @throws std::runtime_error if the iterator is end()
+         */
+        const T& operator*() const;
+
+        /**
+         * @brief Accesses the element pointer
+         * @return Const pointer to the element
+         * @throws std::runtime_error if the iterator is end()
+         */
+        const T* operator->() const;
+
+        /**
+         * @brief Advances to the next larger element (prefix)
+         * @return Reference to this iterator
+         */
+        Iterator& operator++();
+
+        /**
+         * @brief Advances to the next larger element (postfix)
+         * @return Iterator before increment
+         */
+        Iterator operator++(int);
+
+        /**
+         * @brief Moves to the next smaller element, or from end() to the largest (prefix)
+         * @return Reference to this iterator
+         */
+        Iterator& operator--();
+
+        /**
+         * @brief Moves to the next smaller element, or from end() to the largest (postfix)
+         * @return Iterator before decrement
+         */
+        Iterator operator--(int);
+    };
+
+    using Const_Iterator = Iterator;  ///< Elements are always read-only, as in std::set
+    using Reverse_Iterator = std::reverse_iterator<Iterator>;  ///< Descending iterator
+    using Const_Reverse_Iterator = Reverse_Iterator;  ///< Descending read-only iterator
+
     /**
      * @brief Default constructor
      * 
@@ -114,12 +510,204 @@ public:
      */
     Binary_Tree();
 
+    /**
+     * @brief Copy constructor
+     * @param other The tree to copy
+     * 
+     * Copies the shape and heights of the other tree node by node, without rebalancing.
+     */
+    Binary_Tree(const Binary_Tree& other);
+
+    /**
+     * @brief Move constructor
+     * @param other The tree to move from; left empty
+     */
+    Binary_Tree(Binary_Tree&& other) noexcept;
+
+    /**
+     * @brief Copy assignment operator
+     * @param other The tree to copy
+     * @return Reference to this tree
+     */
+    Binary_Tree& operator=(const Binary_Tree& other);
+
+    /**
+     * @brief Move assignment operator
+     * @param other The tree to move from; left empty
+     * @return Reference to this tree
+     */
+    Binary_Tree& operator=(Binary_Tree&& other) noexcept;
+
+    /**
+     * @brief Destructor
+     * 
+     * Releases the node storage block by block.
+     */
+    ~Binary_Tree();
+
+    /**
+     * @brief Returns the number of elements in the tree
+     * @return The number of stored keys
+     * 
+     * O(1), except for the first call on a tree produced by split() (or combined from
+     * one before its size was read), which counts the keys in O(n) unless the
+     * Order_Statistics policy is used.
+     */
+    [[nodiscard]] unsigned long long get_size() const;
+
+    /**
+     * @brief Checks if the tree is empty
+     * @return True if the tree holds no keys, false otherwise
+     */
+    [[nodiscard]] bool empty() const;
+
+    /**
+     * @brief Removes every element from the tree
+     * 
+     * Node destructors only run when T needs them; the storage itself is returned
+     * a whole block at a time rather than node by node.
+     */
+    void clear();
+
+    /**
+     * @brief Replaces the contents with the elements of a sorted range
+     * @param first Start of a range sorted by operator< (duplicates are skipped)
+     * @param last End of the range
+     * @throws std::invalid_argument if the range is not sorted
+     * 
+     * Builds a perfectly balanced tree in O(n) with a single node allocation.
+     */
+    template<class ForwardIt>
+    void build_from_sorted(ForwardIt first, ForwardIt last);
+
+    /**
+     * @brief Inserts every element of a range, in any order
+     * @param first Start of the range
+     * @param last End of the range
+     * 
+     * The batch is sorted and merged with the existing elements, then the tree is
+     * rebuilt in linear time. Small batches are inserted one by one instead.
+     * Node handles and iterators are invalidated when the tree is rebuilt.
+     */
+    template<class InputIt>
+    void bulk_insert(InputIt first, InputIt last);
+
+    /**
+     * @brief Joins two trees around a middle key
+     * @param left Tree whose keys are all less than key; left empty
+     * @param key The middle key, copied into the result
+     * @param right Tree whose keys are all greater than key; left empty
+     * @return A tree holding every key of left, key and every key of right
+     * @throws std::invalid_argument if the keys are not in that order
+     * 
+     * O(log n): the shorter tree is hung off the spine of the taller one and the path
+     * above it is rebalanced. The nodes are not copied; the result takes over the
+     * storage of both trees.
+     */
+    static Binary_Tree join(Binary_Tree&& left, const T& key, Binary_Tree&& right);
+
+    /**
+     * @brief Splits a tree around a key
+     * @param tree The tree to split; left empty
+     * @param key The key to split at
+     * @return Pair of a tree holding the keys less than key and a tree holding the rest
+     * 
+     * O(log n). Both halves keep the original storage alive, which is freed once both
+     * are cleared; neither half's size is known until get_size() is first called.
+     * operator< is assumed not to throw.
+     */
+    static std::pair<Binary_Tree, Binary_Tree> split(Binary_Tree&& tree, const T& key);
+
+    /**
+     * @brief Computes the union of two trees
+     * @param a The first tree; left empty
+     * @param b The second tree; left empty
+     * @return A tree holding every key of either tree, keeping the element of a for a
+     *         key held by both
+     * 
+     * Divide and conquer: b is split around the root of a and the halves are united
+     * recursively, then joined back around that root. Large halves run on separate
+     * threads. O(m log(n/m + 1)) work for sizes m <= n, without copying any element.
+     * operator< is assumed not to throw.
+     */
+    static Binary_Tree set_union(Binary_Tree&& a, Binary_Tree&& b);
+
+    /**
+     * @brief Computes the intersection of two trees
+     * @param a The first tree; left empty
+     * @param b The second tree; left empty
+     * @return A tree holding the keys present in both trees, as stored in a
+     * 
+     * Same recursion and cost as set_union(); nodes left out are destroyed.
+     */
+    static Binary_Tree set_intersection(Binary_Tree&& a, Binary_Tree&& b);
+
+    /**
+     * @brief Computes the difference of two trees
+     * @param a The tree to subtract from; left empty
+     * @param b The keys to remove; left empty
+     * @return A tree holding the keys of a that are not in b
+     * 
+     * Same recursion and cost as set_union(), splitting a around the roots of b.
+     */
+    static Binary_Tree set_difference(Binary_Tree&& a, Binary_Tree&& b);
+
+    /**
+     * @brief Counts the elements less than a key
+     * @param key The key to compare against
+     * @return Number of stored elements that are less than key (the key's position if present)
+     * 
+     * Requires the Order_Statistics policy. O(log n).
+     */
+    unsigned long long rank(const T& key) const;
+
+    /**
+     * @brief Finds the element at a position in sorted order
+     * @param k Zero-based position; select(get_size() - 1 - k) gives the kth largest
+     * @return Iterator to the element
+     * @throws std::out_of_range if k >= get_size()
+     * 
+     * Requires the Order_Statistics policy. O(log n).
+     */
+    Const_Iterator select(unsigned long long k) const;
+
+    /**
+     * @brief Counts the elements in a closed key range
+     * @param lo Smallest key of the range
+     * @param hi Largest key of the range
+     * @return Number of stored elements x with lo <= x <= hi (0 if hi < lo)
+     * 
+     * Requires the Order_Statistics policy. O(log n).
+     */
+    unsigned long long count_range(const T& lo, const T& hi) const;
+
+    /**
+     * @brief Aggregates the elements in a closed key range
+     * @param lo Smallest key of the range
+     * @param hi Largest key of the range
+     * @return The monoid combination, in key order, of every x with lo <= x <= hi
+     *         (the identity if there is none)
+     * 
+     * Requires a Monoid_Augment policy. O(log n).
+     */
+    template<class Policy = Augment>
+    typename Policy::value_type aggregate(const T& lo, const T& hi) const;
+
+    /**
+     * @brief Aggregates every element of the tree
+     * @return The aggregate stored at the root (the identity if the tree is empty)
+     * 
+     * Requires a Monoid_Augment policy. O(1).
+     */
+    template<class Policy = Augment>
+    typename Policy::value_type aggregate() const;
+
     /**
      * @brief Performs pre-order traversal starting from a specific node
      * @param ptr Starting node for traversal (can be nullptr)
      * 
      * Pre-order traversal visits nodes in the order: Root -> Left -> Right
-     * Outputs each node's data to std::cout
+     * Outputs each node's data to std::cout, one per line
      */
     void preOrder(Node *ptr);
     
@@ -129,7 +717,7 @@ public:
      * 
      * In-order traversal visits nodes in the order: Left -> Root -> Right
      * For a BST, this produces elements in sorted order
-     * Outputs each node's data to std::cout
+     * Outputs each node's data to std::cout, one per line
      */
     void inOrder(Node *ptr);
     
@@ -139,7 +727,7 @@ public:
      * 
      * Post-order traversal visits nodes in the order: Left -> Right -> Root
      * Useful for deleting nodes or evaluating expressions
-     * Outputs each node's data to std::cout
+     * Outputs each node's data to std::cout, one per line
      */
     void postOrder(Node *ptr);
     
@@ -149,39 +737,132 @@ public:
      * 
      * Level-order traversal visits nodes level by level, from left to right
      * Uses a queue to maintain the traversal order
-     * Outputs each node's data to std::cout
+     * Outputs each node's data to std::cout, one per line
      */
     void levelOrder(Node *ptr);
 
     /**
-     * @brief Finds the minimum value in the subtree rooted at the given node
-     * @param ptr Root of the subtree to search (can be nullptr)
-     * @return Pointer to the node with minimum value, or nullptr if subtree is empty
+     * @brief Visits every element in pre-order
+     * @param visit Callable taking const T&; it may return bool, and false stops the traversal
+     * @return True if every element was visited, false if the visitor stopped early
      * 
-     * In a BST, the minimum value is always in the leftmost node
+     * Runs in O(n) time and O(1) extra space by climbing parent pointers.
      */
-    static Node* findMin(Node *ptr);
-    
+    template<class Visitor>
+    bool visitPreOrder(Visitor&& visit) const;
+
     /**
-     * @brief Finds the successor of a given node
-     * @param ptr Node whose successor to find (can be nullptr)
-     * @return Pointer to the successor node, or nullptr if no successor exists
+     * @brief Visits every element in sorted order
+     * @param visit Callable taking const T&; it may return bool, and false stops the traversal
+     * @return True if every element was visited, false if the visitor stopped early
      * 
-     * The successor is the next larger element in the tree.
-     * If the node has a right child, the successor is the minimum of the right subtree.
-     * Otherwise, it's the first ancestor that is a left child of its parent.
+     * Runs in O(n) time and O(1) extra space by climbing parent pointers.
      */
-    Node* findSuccessor(Node* ptr);
-    
+    template<class Visitor>
+    bool visitInOrder(Visitor&& visit) const;
+
+    /**
+     * @brief Visits every element in post-order
+     * @param visit Callable taking const T&; it may return bool, and false stops the traversal
+     * @return True if every element was visited, false if the visitor stopped early
+     * 
+     * Runs in O(n) time and O(1) extra space by climbing parent pointers.
+     */
+    template<class Visitor>
+    bool visitPostOrder(Visitor&& visit) const;
+
+    /**
+     * @brief Visits every element level by level
+     * @param visit Callable taking const T&; it may return bool, and false stops the traversal
+     * @return True if every element was visited, false if the visitor stopped early
+     */
+    template<class Visitor>
+    bool visitLevelOrder(Visitor&& visit) const;
+
+    /**
+     * @brief Copies every element in sorted order to an output iterator
+     * @param out Destination iterator
+     * @return Iterator one past the last element written
+     */
+    template<class OutputIt>
+    OutputIt exportInOrder(OutputIt out) const;
+
+    /**
+     * @brief Finds the element equivalent to a key
+     * @param key The key to search for
+     * @return Iterator to the element, or end() if the key is absent
+     * 
+     * Iterative descent using a single operator< comparison per level.
+     */
+    Const_Iterator find(const T& key) const;
+
+    /**
+     * @brief Checks whether a key is stored in the tree
+     * @param key The key to search for
+     * @return True if the key is present, false otherwise
+     */
+    bool contains(const T& key) const;
+
+    /**
+     * @brief Finds the first element that is not less than the given key
+     * @param key The key to compare against
+     * @return Iterator to the first element >= key, or end() if there is none
+     */
+    Const_Iterator lower_bound(const T& key) const;
+
+    /**
+     * @brief Finds the first element that is greater than the given key
+     * @param key The key to compare against
+     * @return Iterator to the first element > key, or end() if there is none
+     */
+    Const_Iterator upper_bound(const T& key) const;
+
+    /**
+     * @brief Finds the range of elements equivalent to the given key
+     * @param key The key to search for
+     * @return Pair of lower_bound(key) and upper_bound(key); the range holds at most one
+     *         element because duplicates are never inserted
+     */
+    std::pair<Const_Iterator, Const_Iterator> equal_range(const T& key) const;
+
+    /**
+     * @brief Removes a key from the tree
+     * @param key The key to remove
+     * @return True if the key was removed, false if it was not present
+     */
+    bool erase(const T& key);
+
     /**
      * @brief Inserts a new element into the tree
      * @param data The data to insert
+     * @return Pair of an iterator to the element with the key and whether it was inserted
      * 
      * Inserts the element while maintaining the BST property and AVL balance.
      * Duplicate elements are ignored (no insertion occurs).
      * Automatically performs rotations if necessary to maintain balance.
+     * The key is copied exactly once, into the new node.
      */
-    void insert(T data);
+    std::pair<Const_Iterator, bool> insert(const T& data);
+
+    /**
+     * @brief Inserts a new element into the tree, moving it into the new node
+     * @param data The data to insert
+     * @return Pair of an iterator to the element with the key and whether it was inserted
+     * 
+     * The key is only moved from if it is inserted.
+     */
+    std::pair<Const_Iterator, bool> insert(T&& data);
+
+    /**
+     * @brief Constructs an element in place and inserts it into the tree
+     * @param args Arguments forwarded to the constructor of T
+     * @return Pair of an iterator to the element with the key and whether it was inserted
+     * 
+     * The key is built once, directly inside its node; if an equivalent key is already
+     * present the new node is discarded.
+     */
+    template<class... Args>
+    std::pair<Const_Iterator, bool> emplace(Args&&... args);
 
     /**
      * @brief Performs pre-order traversal of the entire tree
@@ -214,6 +895,50 @@ public:
      * @see levelOrder(Node*)
      */
     void levelOrder() { levelOrder(this->root); }
+
+    /**
+     * @brief Returns an iterator to the smallest element
+     * @return Iterator to the first element in sorted order, or end() if empty
+     */
+    Const_Iterator begin() const;
+
+    /**
+     * @brief Returns an iterator past the largest element
+     * @return The end iterator
+     */
+    Const_Iterator end() const;
+
+    /**
+     * @brief Returns an iterator to the smallest element
+     * @return Iterator to the first element in sorted order, or cend() if empty
+     */
+    Const_Iterator cbegin() const { return begin(); }
+
+    /**
+     * @brief Returns an iterator past the largest element
+     * @return The end iterator
+     */
+    Const_Iterator cend() const { return end(); }
+
+    /**
+     * @brief Returns a reverse iterator to the largest element
+     * @return Reverse iterator to the first element in descending order
+     */
+    Const_Reverse_Iterator rbegin() const { return Const_Reverse_Iterator(end()); }
+
+    /**
+     * @brief Returns a reverse iterator past the smallest element
+     * @return The reverse end iterator
+     */
+    Const_Reverse_Iterator rend() const { return Const_Reverse_Iterator(begin()); }
+
+    /**
+     * @brief Removes the element an iterator points to
+     * @param pos Iterator to the element to remove. Must not be end().
+     * @return Iterator to the element that followed the removed one
+     * @throws std::runtime_error if pos is end()
+     */
+    Iterator erase(Iterator pos);
 };
 
 
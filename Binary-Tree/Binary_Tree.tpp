@@ -5,9 +5,18 @@
  * This file contains the complete implementation of all methods declared
  * in Binary_Tree.hpp. The implementation includes:
  * - Node construction and tree initialization
- * - Four types of tree traversals
+ * - Four types of tree traversals, stackless over parent pointers
+ * - Visitor traversals with early exit and bulk export to output iterators
  * - AVL balancing with four rotation cases
- * - Successor finding algorithms
+ * - Iterative insertion and emplace with early-stopping retracing
+ * - Successor and predecessor finding algorithms
+ * - Bidirectional iterators driven by parent pointers
+ * - Iterative lookups (find, contains, lower_bound, upper_bound, equal_range)
+ * - Deletion with early-stopping retracing
+ * - Copy, move, clear and destruction over arena-backed node storage
+ * - Linear-time bulk construction and batch insertion
+ * - Augmentation hooks, order-statistic queries and range aggregates
+ * - Join and split, and the parallel set operations built on them
  * - Height and balance factor calculations
  * 
  * @author Eyad
@@ -16,111 +25,614 @@
  * 
  * Implementation Notes:
  * - All rotations maintain parent pointers for efficient navigation
- * - Height is updated after each insertion and rotation
+ * - Height and policy data are updated after each insertion, deletion and rotation
  * - Balance factors are calculated using height differences
  * - Duplicate insertions are handled gracefully (no insertion)
- * - Memory management is handled by the calling code
+ * - Nodes live in a Node_Arena owned by the tree and are released with it
  */
 
 #pragma once
 
 #include "Binary_Tree.hpp"
-#include <queue>
+#include <vector>
+#include <algorithm>
+#include <iterator>
 #include <iostream>
+#include <stdexcept>
+#include <type_traits>
+#include <future>
+#include <thread>
+#include <system_error>
 using namespace std;
 
 
 /**
- * @brief Constructs a new node with the given data
+ * @brief Constructs a new node, building its data in place
  * 
  * Initializes all pointers to nullptr and sets height to 0.
  * The node is ready to be inserted into the tree.
  * 
- * @param data The data to store in the node
+ * @param args Arguments forwarded to the constructor of T
  */
-template<class T>
-Binary_Tree<T>::Node::Node(T data): data(data), left(nullptr), right(nullptr), parent(nullptr), height(0) {}
+template<class T, class Augment>
+template<class... Args>
+Binary_Tree<T, Augment>::Node::Node(Args&&... args): data(std::forward<Args>(args)...), left(nullptr), right(nullptr), parent(nullptr), height(0) {}
 
 /**
  * @brief Default constructor for the AVL tree
  * 
  * Creates an empty tree with no nodes. The root pointer is set to nullptr.
  */
-template<class T>
-Binary_Tree<T>::Binary_Tree(): root(nullptr) {}
+template<class T, class Augment>
+Binary_Tree<T, Augment>::Binary_Tree(): root(nullptr), count(0) {}
+
+/**
+ * @brief Copy constructor
+ * 
+ * Walks both trees in lockstep using parent pointers, creating each missing child
+ * in the copy as it is reached. No recursion, stack or rebalancing is needed, and
+ * the copy has exactly the same shape and heights as the original. Nodes are counted
+ * as they are created, so the other tree's cached size is never touched.
+ * 
+ * @param other The tree to copy
+ */
+template<class T, class Augment>
+Binary_Tree<T, Augment>::Binary_Tree(const Binary_Tree &other): root(nullptr), count(0) {
+    if (other.root == nullptr) return;
+
+    root = nodes.create(other.root->data);
+    unsigned long long copied = 1;
+    root->height = other.root->height;
+    static_cast<Augment_Data&>(*root) = *other.root;
+    const Node* source = other.root;
+    Node* target = root;
+
+    try {
+        while (true) {
+            if (source->left != nullptr && target->left == nullptr) {
+                target->left = nodes.create(source->left->data);
+                ++copied;
+                target->left->parent = target;
+                target->left->height = source->left->height;
+                static_cast<Augment_Data&>(*target->left) = *source->left;
+                source = source->left;
+                target = target->left;
+            }
+            else if (source->right != nullptr && target->right == nullptr) {
+                target->right = nodes.create(source->right->data);
+                ++copied;
+                target->right->parent = target;
+                target->right->height = source->right->height;
+                static_cast<Augment_Data&>(*target->right) = *source->right;
+                source = source->right;
+                target = target->right;
+            }
+            else if (source == other.root) {
+                break;
+            }
+            else {
+                source = source->parent;
+                target = target->parent;
+            }
+        }
+    }
+    catch (...) {
+        // Destroy the partial copy before rethrowing, since the destructor will not run
+        clear();
+        throw;
+    }
+    count.store(copied, memory_order_relaxed);
+}
+
+/**
+ * @brief Move constructor
+ * 
+ * Takes over the root and the node storage of the other tree.
+ * 
+ * @param other The tree to move from; left empty
+ */
+template<class T, class Augment>
+Binary_Tree<T, Augment>::Binary_Tree(Binary_Tree &&other) noexcept: root(other.root), nodes(std::move(other.nodes)), count(other.count.load(memory_order_relaxed)) {
+    other.root = nullptr;
+    other.count.store(0, memory_order_relaxed);
+}
+
+/**
+ * @brief Copy assignment operator
+ * 
+ * Copies into a temporary and swaps it in, so this tree is unchanged if copying throws.
+ * 
+ * @param other The tree to copy
+ * @return Reference to this tree
+ */
+template<class T, class Augment>
+Binary_Tree<T, Augment> &Binary_Tree<T, Augment>::operator=(const Binary_Tree &other) {
+    if (this != &other) {
+        Binary_Tree copy(other);
+        std::swap(root, copy.root);
+        nodes.swap(copy.nodes);
+        count.store(copy.count.load(memory_order_relaxed), memory_order_relaxed);
+    }
+    return *this;
+}
+
+/**
+ * @brief Move assignment operator
+ * 
+ * @param other The tree to move from; left empty
+ * @return Reference to this tree
+ */
+template<class T, class Augment>
+Binary_Tree<T, Augment> &Binary_Tree<T, Augment>::operator=(Binary_Tree &&other) noexcept {
+    if (this != &other) {
+        clear();
+        std::swap(root, other.root);
+        nodes.swap(other.nodes);
+        count.store(other.count.exchange(0, memory_order_relaxed), memory_order_relaxed);
+    }
+    return *this;
+}
+
+/**
+ * @brief Destructor
+ * 
+ * @see clear()
+ */
+template<class T, class Augment>
+Binary_Tree<T, Augment>::~Binary_Tree() {
+    clear();
+}
+
+/**
+ * @brief Returns the number of elements in the tree
+ * 
+ * The count is kept up to date by every insertion and removal. split() cannot know
+ * the sizes of its halves in O(log n), so it leaves them to be counted here on the
+ * first call, or read from the root with the Order_Statistics policy. The cache is
+ * atomic, so concurrent calls on a const tree are safe.
+ * 
+ * @return The number of stored keys
+ */
+template<class T, class Augment>
+unsigned long long Binary_Tree<T, Augment>::get_size() const {
+    unsigned long long size = count.load(memory_order_relaxed);
+    if (size == UNKNOWN_SIZE) {
+        if constexpr (Augment::ORDER_STATISTICS) {
+            size = Augment::size_of(root);
+        }
+        else {
+            size = 0;
+            walkInOrder(root, [&size](const T&) { ++size; });
+        }
+        // Concurrent readers may both count, but they store the same value
+        count.store(size, memory_order_relaxed);
+    }
+    return size;
+}
+
+/**
+ * @brief Checks if the tree is empty
+ * 
+ * @return True if the tree holds no keys, false otherwise
+ */
+template<class T, class Augment>
+bool Binary_Tree<T, Augment>::empty() const {
+    return root == nullptr;
+}
+
+/**
+ * @brief Removes every element from the tree
+ * 
+ * When T has a non-trivial destructor, every node is destroyed first by repeatedly
+ * rotating left children up and peeling off the root, which visits each node once
+ * without recursion or an auxiliary stack. Trivially destructible nodes are skipped
+ * entirely. The arena then frees its blocks, so tearing down n nodes costs about
+ * n / Node_Arena::MAX_BLOCK deallocations instead of n.
+ */
+template<class T, class Augment>
+void Binary_Tree<T, Augment>::clear() {
+    if constexpr (!std::is_trivially_destructible<Node>::value) {
+        Node* curr = root;
+        while (curr != nullptr) {
+            if (curr->left != nullptr) {
+                Node* left = curr->left;
+                curr->left = left->right;
+                left->right = curr;
+                curr = left;
+            }
+            else {
+                Node* next = curr->right;
+                curr->~Node();
+                curr = next;
+            }
+        }
+    }
+    nodes.clear();
+    root = nullptr;
+    count.store(0, memory_order_relaxed);
+}
+
+/**
+ * @brief Replaces the contents with the elements of a sorted range
+ * 
+ * A first pass checks the order and counts the distinct keys, so the arena can
+ * reserve one block for exactly that many nodes. The second pass builds the tree:
+ * the middle key of every subrange becomes a subtree root, so sibling subtrees
+ * differ in size by at most one and all heights are set bottom-up without a single
+ * rotation. Nodes are created in sorted order and so sit in memory in sorted order.
+ * 
+ * @param first Start of a range sorted by operator< (duplicates are skipped)
+ * @param last End of the range
+ * @throws std::invalid_argument if the range is not sorted; the tree is unchanged
+ */
+template<class T, class Augment>
+template<class ForwardIt>
+void Binary_Tree<T, Augment>::build_from_sorted(ForwardIt first, ForwardIt last) {
+    unsigned long long distinct = 0;
+    for (ForwardIt prev = first, it = first; it != last; prev = it++) {
+        if (it == first || *prev < *it) {
+            ++distinct;
+        }
+        else if (*it < *prev) {
+            throw std::invalid_argument("Range is not sorted in build_from_sorted()");
+        }
+    }
+
+    clear();
+    nodes.reserve(distinct);
+    root = buildBalanced(first, last, distinct);
+    count.store(distinct, memory_order_relaxed);
+    if (root != nullptr) {
+        root->parent = nullptr;
+    }
+}
+
+/**
+ * @brief Builds a balanced subtree from the next count distinct keys of a sorted range
+ * 
+ * The left subtree takes (count - 1) / 2 keys and the right subtree the rest, which
+ * keeps the two heights within one of each other. Keys equivalent to the one just
+ * consumed are skipped. Recursion depth is O(log n).
+ * 
+ * @param it Current position in the range; advanced past the consumed keys
+ * @param last End of the range
+ * @param count Number of distinct keys to consume
+ * @return Root of the new subtree (its parent is left unset)
+ */
+template<class T, class Augment>
+template<class ForwardIt>
+typename Binary_Tree<T, Augment>::Node *Binary_Tree<T, Augment>::buildBalanced(ForwardIt &it, ForwardIt last, unsigned long long count) {
+    if (count == 0) return nullptr;
+
+    const unsigned long long leftCount = (count - 1) / 2;
+    Node* left = buildBalanced(it, last, leftCount);
+
+    Node* node = nodes.create(*it);
+    for (++it; it != last && !(node->data < *it); ++it) {}
+
+    Node* right = buildBalanced(it, last, count - 1 - leftCount);
+    node->left = left;
+    node->right = right;
+    if (left != nullptr) left->parent = node;
+    if (right != nullptr) right->parent = node;
+    node->height = 1 + max(height(left), height(right));
+    Augment::update(node);
+    return node;
+}
+
+/**
+ * @brief Inserts every element of a range, in any order
+ * 
+ * The batch is copied, sorted and deduplicated in O(m log m). If it is small compared
+ * to the tree (m * height < n), the keys are inserted one by one in O(m log n).
+ * Otherwise the existing keys are moved out in order, merged with the batch in
+ * O(n + m), keeping the existing key when both sides hold an equivalent one, and the
+ * tree is rebuilt with build_from_sorted().
+ * 
+ * @param first Start of the range
+ * @param last End of the range
+ */
+template<class T, class Augment>
+template<class InputIt>
+void Binary_Tree<T, Augment>::bulk_insert(InputIt first, InputIt last) {
+    vector<T> batch(first, last);
+    sort(batch.begin(), batch.end());
+    batch.erase(unique(batch.begin(), batch.end(), [](const T& a, const T& b) { return !(a < b); }), batch.end());
+
+    const unsigned long long size = get_size();
+    if (batch.size() * static_cast<unsigned long long>(height(root) + 1) < size) {
+        for (T& key : batch) {
+            insert(std::move(key));
+        }
+        return;
+    }
+
+    vector<T> merged;
+    merged.reserve(size + batch.size());
+    auto next = batch.begin();
+    for (Node* curr = findMin(root); curr != nullptr; curr = findSuccessor(curr)) {
+        for (; next != batch.end() && *next < curr->data; ++next) {
+            merged.push_back(std::move(*next));
+        }
+        if (next != batch.end() && !(curr->data < *next)) {
+            ++next;
+        }
+        merged.push_back(std::move(curr->data));
+    }
+    merged.insert(merged.end(), make_move_iterator(next), make_move_iterator(batch.end()));
+
+    build_from_sorted(make_move_iterator(merged.begin()), make_move_iterator(merged.end()));
+}
 
 /**
  * @brief Performs pre-order traversal (Root -> Left -> Right)
  * 
- * Visits the current node first, then recursively traverses the left subtree,
- * and finally the right subtree. This order is useful for creating a copy
- * of the tree or evaluating prefix expressions.
+ * Visits the current node first, then the left subtree, and finally the right
+ * subtree. This order is useful for creating a copy of the tree or evaluating
+ * prefix expressions. Output is flushed once at the end rather than per node.
  * 
  * @param ptr Starting node for traversal
  */
-template<class T>
-void Binary_Tree<T>::preOrder(Node *ptr) {
-    if (ptr == nullptr) return;
-        cout << ptr->data << endl;
-        preOrder(ptr->left);
-        preOrder(ptr->right);
+template<class T, class Augment>
+void Binary_Tree<T, Augment>::preOrder(Node *ptr) {
+    walkPreOrder(ptr, [](const T& data) { cout << data << '\n'; });
+    cout.flush();
 }
 
 /**
  * @brief Performs in-order traversal (Left -> Root -> Right)
  * 
- * Recursively traverses the left subtree, visits the current node,
- * then traverses the right subtree. For a BST, this produces
- * elements in sorted order.
+ * Visits the left subtree, the current node, then the right subtree.
+ * For a BST, this produces elements in sorted order.
+ * Output is flushed once at the end rather than per node.
  * 
  * @param ptr Starting node for traversal
  */
-template<class T>
-void Binary_Tree<T>::inOrder(Node *ptr) {
-    if (ptr == nullptr) return;
-        inOrder(ptr->left);
-        cout << ptr->data << endl;
-        inOrder(ptr->right);
+template<class T, class Augment>
+void Binary_Tree<T, Augment>::inOrder(Node *ptr) {
+    walkInOrder(ptr, [](const T& data) { cout << data << '\n'; });
+    cout.flush();
 }
 
 /**
  * @brief Performs post-order traversal (Left -> Right -> Root)
  * 
- * Recursively traverses the left subtree, then the right subtree,
- * and finally visits the current node. This order is useful for
- * deleting nodes or evaluating postfix expressions.
+ * Visits the left subtree, then the right subtree, and finally the current
+ * node. This order is useful for deleting nodes or evaluating postfix
+ * expressions. Output is flushed once at the end rather than per node.
  * 
  * @param ptr Starting node for traversal
  */
-template<class T>
-void Binary_Tree<T>::postOrder(Node *ptr) {
-    if (ptr == nullptr) return;
-        postOrder(ptr->left);
-        postOrder(ptr->right);
-        cout << ptr->data << endl;
+template<class T, class Augment>
+void Binary_Tree<T, Augment>::postOrder(Node *ptr) {
+    walkPostOrder(ptr, [](const T& data) { cout << data << '\n'; });
+    cout.flush();
 }
 
 /**
  * @brief Performs level-order (breadth-first) traversal
  * 
- * Visits nodes level by level, from left to right. Uses a queue to maintain
- * the traversal order. This traversal is useful for finding the shortest path
- * or printing the tree in a hierarchical format.
+ * Visits nodes level by level, from left to right. This traversal is useful
+ * for finding the shortest path or printing the tree in a hierarchical format.
+ * Output is flushed once at the end rather than per node.
  * 
  * @param ptr Starting node for traversal
  */
-template<class T>
-void Binary_Tree<T>::levelOrder(Node *ptr) {
-    if (ptr == nullptr) return;
-    queue<Node*> q;
-    q.emplace(ptr);
-    while (!q.empty()) {
-        Node* curr = q.front();
-        cout << curr->data << endl;
-        if (curr->left != nullptr) q.emplace(curr->left);
-        if (curr->right != nullptr) q.emplace(curr->right);
-        q.pop();
+template<class T, class Augment>
+void Binary_Tree<T, Augment>::levelOrder(Node *ptr) {
+    walkLevelOrder(ptr, [](const T& data) { cout << data << '\n'; });
+    cout.flush();
+}
+
+/**
+ * @brief Invokes a visitor on an element and reports whether to continue
+ * 
+ * Visitors returning something convertible to bool stop the traversal by
+ * returning false; visitors returning void always continue.
+ * 
+ * @param visit The visitor
+ * @param data The element to visit
+ * @return False if the visitor asked to stop, true otherwise
+ */
+template<class T, class Augment>
+template<class Visitor>
+bool Binary_Tree<T, Augment>::proceed(Visitor &visit, const T &data) {
+    if constexpr (std::is_convertible<decltype(visit(data)), bool>::value) {
+        return static_cast<bool>(visit(data));
+    }
+    else {
+        visit(data);
+        return true;
+    }
+}
+
+/**
+ * @brief Visits a subtree in pre-order without recursion or a stack
+ * 
+ * After visiting a node the walk moves to its left child, else its right child.
+ * At a leaf it climbs until it arrives from a left child whose sibling exists,
+ * never climbing above the subtree root.
+ * 
+ * @param top Root of the subtree (can be nullptr)
+ * @param visit The visitor
+ * @return True if every node was visited, false if the visitor stopped early
+ */
+template<class T, class Augment>
+template<class Visitor>
+bool Binary_Tree<T, Augment>::walkPreOrder(Node *top, Visitor &&visit) {
+    Node* curr = top;
+    while (curr != nullptr) {
+        if (!proceed(visit, curr->data)) return false;
+
+        if (curr->left != nullptr) {
+            curr = curr->left;
+        }
+        else if (curr->right != nullptr) {
+            curr = curr->right;
+        }
+        else {
+            Node* next = nullptr;
+            while (next == nullptr && curr != top) {
+                Node* parent = curr->parent;
+                if (curr == parent->left) {
+                    next = parent->right;
+                }
+                curr = parent;
+            }
+            curr = next;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Visits a subtree in order without recursion or a stack
+ * 
+ * Uses the same successor steps as the iterators, bounded by the subtree root.
+ * 
+ * @param top Root of the subtree (can be nullptr)
+ * @param visit The visitor
+ * @return True if every node was visited, false if the visitor stopped early
+ */
+template<class T, class Augment>
+template<class Visitor>
+bool Binary_Tree<T, Augment>::walkInOrder(Node *top, Visitor &&visit) {
+    Node* curr = findMin(top);
+    while (curr != nullptr) {
+        if (!proceed(visit, curr->data)) return false;
+
+        if (curr->right != nullptr) {
+            curr = findMin(curr->right);
+        }
+        else {
+            while (curr != top && curr == curr->parent->right) {
+                curr = curr->parent;
+            }
+            curr = (curr == top) ? nullptr : curr->parent;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Visits a subtree in post-order without recursion or a stack
+ * 
+ * Starts at the first leaf reached by preferring left children. After a node,
+ * the walk moves to its parent, or first descends to the first leaf of the
+ * parent's right subtree when arriving from the left.
+ * 
+ * @param top Root of the subtree (can be nullptr)
+ * @param visit The visitor
+ * @return True if every node was visited, false if the visitor stopped early
+ */
+template<class T, class Augment>
+template<class Visitor>
+bool Binary_Tree<T, Augment>::walkPostOrder(Node *top, Visitor &&visit) {
+    if (top == nullptr) return true;
+
+    auto firstLeaf = [](Node* ptr) {
+        while (ptr->left != nullptr || ptr->right != nullptr) {
+            ptr = (ptr->left != nullptr) ? ptr->left : ptr->right;
+        }
+        return ptr;
+    };
+
+    Node* curr = firstLeaf(top);
+    while (true) {
+        if (!proceed(visit, curr->data)) return false;
+        if (curr == top) return true;
+
+        Node* parent = curr->parent;
+        curr = (curr == parent->left && parent->right != nullptr) ? firstLeaf(parent->right) : parent;
+    }
+}
+
+/**
+ * @brief Visits a subtree level by level
+ * 
+ * Breadth-first order needs a queue; it is kept as a vector read from a moving
+ * head, so its storage grows geometrically and is freed once at the end.
+ * 
+ * @param top Root of the subtree (can be nullptr)
+ * @param visit The visitor
+ * @return True if every node was visited, false if the visitor stopped early
+ */
+template<class T, class Augment>
+template<class Visitor>
+bool Binary_Tree<T, Augment>::walkLevelOrder(Node *top, Visitor &&visit) {
+    if (top == nullptr) return true;
+
+    vector<Node*> pending;
+    pending.push_back(top);
+    for (size_t head = 0; head < pending.size(); ++head) {
+        Node* curr = pending[head];
+        if (!proceed(visit, curr->data)) return false;
+        if (curr->left != nullptr) pending.push_back(curr->left);
+        if (curr->right != nullptr) pending.push_back(curr->right);
     }
+    return true;
+}
+
+/**
+ * @brief Visits every element in pre-order
+ * 
+ * @param visit Callable taking const T&; returning false stops the traversal
+ * @return True if every element was visited, false if the visitor stopped early
+ */
+template<class T, class Augment>
+template<class Visitor>
+bool Binary_Tree<T, Augment>::visitPreOrder(Visitor &&visit) const {
+    return walkPreOrder(root, visit);
+}
+
+/**
+ * @brief Visits every element in sorted order
+ * 
+ * @param visit Callable taking const T&; returning false stops the traversal
+ * @return True if every element was visited, false if the visitor stopped early
+ */
+template<class T, class Augment>
+template<class Visitor>
+bool Binary_Tree<T, Augment>::visitInOrder(Visitor &&visit) const {
+    return walkInOrder(root, visit);
+}
+
+/**
+ * @brief Visits every element in post-order
+ * 
+ * @param visit Callable taking const T&; returning false stops the traversal
+ * @return True if every element was visited, false if the visitor stopped early
+ */
+template<class T, class Augment>
+template<class Visitor>
+bool Binary_Tree<T, Augment>::visitPostOrder(Visitor &&visit) const {
+    return walkPostOrder(root, visit);
+}
+
+/**
+ * @brief Visits every element level by level
+ * 
+ * @param visit Callable taking const T&; returning false stops the traversal
+ * @return True if every element was visited, false if the visitor stopped early
+ */
+template<class T, class Augment>
+template<class Visitor>
+bool Binary_Tree<T, Augment>::visitLevelOrder(Visitor &&visit) const {
+    return walkLevelOrder(root, visit);
+}
+
+/**
+ * @brief Copies every element in sorted order to an output iterator
+ * 
+ * @param out Destination iterator, e.g. std::back_inserter or a pointer into a buffer
+ *            with room for get_size() elements
+ * @return Iterator one past the last element written
+ */
+template<class T, class Augment>
+template<class OutputIt>
+OutputIt Binary_Tree<T, Augment>::exportInOrder(OutputIt out) const {
+    walkInOrder(root, [&out](const T& data) { *out++ = data; });
+    return out;
 }
 
 /**
@@ -132,8 +644,8 @@ void Binary_Tree<T>::levelOrder(Node *ptr) {
  * @param ptr Root of the subtree to search
  * @return Pointer to the node with minimum value, or nullptr if subtree is empty
  */
-template<class T>
-typename Binary_Tree<T>::Node *Binary_Tree<T>::findMin(Node *ptr) {
+template<class T, class Augment>
+typename Binary_Tree<T, Augment>::Node *Binary_Tree<T, Augment>::findMin(Node *ptr) {
     if (ptr == nullptr) return nullptr;
     while (ptr->left != nullptr) {
         ptr = ptr->left;
@@ -152,8 +664,8 @@ typename Binary_Tree<T>::Node *Binary_Tree<T>::findMin(Node *ptr) {
  * @param ptr Node whose successor to find
  * @return Pointer to the successor node, or nullptr if no successor exists
  */
-template<class T>
-typename Binary_Tree<T>::Node *Binary_Tree<T>::findSuccessor(Node *ptr) {
+template<class T, class Augment>
+typename Binary_Tree<T, Augment>::Node *Binary_Tree<T, Augment>::findSuccessor(Node *ptr) {
     if (ptr == nullptr) return nullptr;
 
     if (ptr->right != nullptr) {
@@ -172,185 +684,1412 @@ typename Binary_Tree<T>::Node *Binary_Tree<T>::findSuccessor(Node *ptr) {
 }
 
 /**
- * @brief Calculates the height of a node
+ * @brief Finds the maximum value in the subtree rooted at the given node
  * 
- * Returns -1 for nullptr nodes (empty subtrees) and the stored height
- * for actual nodes. This convention allows for easy height calculations
- * in the balancing logic.
+ * Mirror image of findMin(): follows right children until there are none.
  * 
- * @param ptr Pointer to the node (can be nullptr)
- * @return Height of the node (-1 for nullptr, actual height otherwise)
+ * @param ptr Root of the subtree to search
+ * @return Pointer to the node with maximum value, or nullptr if subtree is empty
  */
-template<class T>
-int Binary_Tree<T>::height(Node *ptr) {
-    return  (ptr == nullptr) ? -1 : ptr->height;
+template<class T, class Augment>
+typename Binary_Tree<T, Augment>::Node *Binary_Tree<T, Augment>::findMax(Node *ptr) {
+    if (ptr == nullptr) return nullptr;
+    while (ptr->right != nullptr) {
+        ptr = ptr->right;
+    }
+    return ptr;
 }
 
 /**
- * @brief Calculates the balance factor of a node
+ * @brief Finds the in-order predecessor of a given node
  * 
- * The balance factor is defined as: height(left subtree) - height(right subtree)
- * For an AVL tree to be balanced, the absolute value of the balance factor
- * must be ≤ 1 for all nodes.
+ * Mirror image of findSuccessor():
+ * 1. If the node has a left child: predecessor is the maximum in the left subtree
+ * 2. If the node has no left child: predecessor is the first ancestor that is
+ *    a right child of its parent (i.e., the first ancestor where we came from the right)
  * 
- * @param ptr Pointer to the node (can be nullptr)
- * @return Balance factor = height(left) - height(right)
+ * @param ptr Node whose predecessor to find
+ * @return Pointer to the predecessor node, or nullptr if no predecessor exists
  */
-template<class T>
-int Binary_Tree<T>::getBalance(Node *ptr) {
-    return (ptr == nullptr) ? -1 : height(ptr->left) - height(ptr->right);
-}
+template<class T, class Augment>
+typename Binary_Tree<T, Augment>::Node *Binary_Tree<T, Augment>::findPredecessor(Node *ptr) {
+    if (ptr == nullptr) return nullptr;
 
-/**
- * @brief Performs a right rotation around the given node
- * 
- * Right rotation is used to balance the tree when the left subtree is too tall.
- * The operation involves:
- * 1. Making the left child (x) the new root of the subtree
- * 2. Moving the original root (y) to be the right child of x
- * 3. Moving x's right subtree (T2) to be y's left subtree
- * 4. Updating all parent pointers and heights
- * 
- * @param y The node around which to perform the rotation
- * @return Pointer to the new root of the rotated subtree
- */
-template<class T>
-typename Binary_Tree<T>::Node *Binary_Tree<T>::rightRotate(Node *y) {
-    if (y == nullptr || y->left == nullptr) {
-        return y;
+    if (ptr->left != nullptr) {
+        return findMax(ptr->left);
     }
-    
-    Node* x = y->left;
-    Node* T2 = x->right;
 
-    x->right = y;
-    x->parent = y->parent;
-    y->parent = x;
-    y->left = T2;
+    Node* ptrParent = ptr->parent;
+    Node* curr = ptr;
 
-    if (T2 != nullptr) {
-        T2->parent = y;
+    while (ptrParent != nullptr && curr == ptrParent->left) {
+        curr = ptrParent;
+        ptrParent = ptrParent->parent;
     }
 
-    x->height = 1 + max(height(x->left), height(x->right));
-    y->height = 1 + max(height(y->left), height(y->right));
-
-    return x;
+    return ptrParent;
 }
 
 /**
- * @brief Performs a left rotation around the given node
+ * @brief Constructs an iterator for a given node and tree
  * 
- * Left rotation is used to balance the tree when the right subtree is too tall.
- * The operation involves:
- * 1. Making the right child (y) the new root of the subtree
- * 2. Moving the original root (x) to be the left child of y
- * 3. Moving y's left subtree (T2) to be x's right subtree
- * 4. Updating all parent pointers and heights
+ * @param p Pointer to the node (nullptr for end)
+ * @param t Pointer to the tree
+ */
+template<class T, class Augment>
+Binary_Tree<T, Augment>::Iterator::Iterator(Node *p, const Binary_Tree *t): curr(p), tree(t) {}
+
+/**
+ * @brief Default constructor. Creates an end iterator not bound to any tree.
+ */
+template<class T, class Augment>
+Binary_Tree<T, Augment>::Iterator::Iterator(): curr(nullptr), tree(nullptr) {}
+
+/**
+ * @brief Checks if two iterators are equal
  * 
- * @param x The node around which to perform the rotation
- * @return Pointer to the new root of the rotated subtree
+ * @param other The iterator to compare with
+ * @return True if both refer to the same node, false otherwise
  */
-template<class T>
-typename Binary_Tree<T>::Node *Binary_Tree<T>::leftRotate(Node *x) {
-    if (x == nullptr || x->right == nullptr) {
-        return x;
-    }
-    
-    Node* y = x->right;
-    Node* T2 = y->left;
+template<class T, class Augment>
+bool Binary_Tree<T, Augment>::Iterator::operator==(const Iterator &other) const {
+    return curr == other.curr;
+}
 
-    y->left = x;
-    y->parent = x->parent;
-    x->parent = y;
-    x->right = T2;
+/**
+ * @brief Checks if two iterators are not equal
+ * 
+ * @param other The iterator to compare with
+ * @return True if they refer to different nodes, false otherwise
+ */
+template<class T, class Augment>
+bool Binary_Tree<T, Augment>::Iterator::operator!=(const Iterator &other) const {
+    return curr != other.curr;
+}
 
-    if (T2 != nullptr) {
-        T2->parent = x;
+/**
+ * @brief Dereferences the iterator to access the element
+ * 
+ * @return Const reference to the element
+ * @throws std::runtime_error if the iterator is end()
+ */
+template<class T, class Augment>
+const T &Binary_Tree<T, Augment>::Iterator::operator*() const {
+    if (curr) {
+        return curr->data;
     }
+    throw std::runtime_error("Dereferencing a null iterator.");
+}
 
-    y->height = 1 + max(height(y->left), height(y->right));
-    x->height = 1 + max(height(x->left), height(x->right));
-
-    return y;
+/**
+ * @brief Accesses the element pointer
+ * 
+ * @return Const pointer to the element
+ * @throws std::runtime_error if the iterator is end()
+ */
+template<class T, class Augment>
+const T *Binary_Tree<T, Augment>::Iterator::operator->() const {
+    if (!curr) {
+        throw std::runtime_error("Cannot access member via end() iterator");
+    }
+    return &(curr->data);
 }
 
 /**
- * @brief Public interface for inserting a new element into the tree
+ * @brief Advances to the next larger element (prefix)
  * 
- * This is the main insertion method that users call to add elements to the tree.
- * It delegates to the private recursive insertion method and handles the root
- * pointer update.
+ * Each edge of the tree is crossed at most twice over a full scan, so the cost is
+ * O(1) amortized per step even though a single step can climb O(log n) levels.
+ * Incrementing end() leaves it at end().
  * 
- * @param data The data to insert into the tree
+ * @return Reference to this iterator
  */
-template<class T>
-void Binary_Tree<T>::insert(T data) {
-    this->root = insert(this->root, data, nullptr);
+template<class T, class Augment>
+typename Binary_Tree<T, Augment>::Iterator &Binary_Tree<T, Augment>::Iterator::operator++() {
+    if (curr) {
+        curr = findSuccessor(curr);
+    }
+    return *this;
 }
 
 /**
- * @brief Recursively inserts a new element into the tree with AVL balancing
+ * @brief Advances to the next larger element (postfix)
  * 
- * This is the core insertion algorithm that:
- * 1. Recursively finds the correct position for the new element
- * 2. Creates a new node and links it into the tree
- * 3. Updates heights of all affected nodes
- * 4. Checks balance factors and performs rotations if necessary
- * 
- * The four AVL rotation cases are handled:
- * - Left-Left: Single right rotation
- * - Right-Right: Single left rotation  
- * - Left-Right: Double rotation (left then right)
- * - Right-Left: Double rotation (right then left)
+ * @return Iterator before increment
+ */
+template<class T, class Augment>
+typename Binary_Tree<T, Augment>::Iterator Binary_Tree<T, Augment>::Iterator::operator++(int) {
+    Iterator temp = *this;
+    ++(*this);
+    return temp;
+}
+
+/**
+ * @brief Moves to the next smaller element, or from end() to the largest (prefix)
  * 
- * @param ptr Current node in the recursion
- * @param data Data to insert
- * @param parent Parent of the current node
- * @return Pointer to the root of the modified subtree
+ * @return Reference to this iterator
  */
-template<class T>
-typename Binary_Tree<T>::Node *Binary_Tree<T>::insert(Node *ptr, T data, Node *parent) {
-    if ((ptr == nullptr)) {
-        Node* newNode = new Node(data);
-        newNode->parent = parent;
-        return newNode;
+template<class T, class Augment>
+typename Binary_Tree<T, Augment>::Iterator &Binary_Tree<T, Augment>::Iterator::operator--() {
+    if (!curr) {
+        if (tree) {
+            curr = findMax(tree->root);
+        }
+        return *this;
     }
+    curr = findPredecessor(curr);
+    return *this;
+}
 
-    if (data < ptr->data) {
-        ptr->left = insert(ptr->left, data, ptr);
+/**
+ * @brief Moves to the next smaller element, or from end() to the largest (postfix)
+ * 
+ * @return Iterator before decrement
+ */
+template<class T, class Augment>
+typename Binary_Tree<T, Augment>::Iterator Binary_Tree<T, Augment>::Iterator::operator--(int) {
+    Iterator temp = *this;
+    --(*this);
+    return temp;
+}
+
+/**
+ * @brief Returns an iterator to the smallest element
+ * 
+ * @return Iterator to the first element in sorted order, or end() if empty
+ */
+template<class T, class Augment>
+typename Binary_Tree<T, Augment>::Const_Iterator Binary_Tree<T, Augment>::begin() const {
+    return Const_Iterator(findMin(root), this);
+}
+
+/**
+ * @brief Returns an iterator past the largest element
+ * 
+ * @return The end iterator
+ */
+template<class T, class Augment>
+typename Binary_Tree<T, Augment>::Const_Iterator Binary_Tree<T, Augment>::end() const {
+    return Const_Iterator(nullptr, this);
+}
+
+/**
+ * @brief Finds the element equivalent to a key
+ * 
+ * Descends to lower_bound(key) and then checks the candidate for equivalence, so every
+ * level costs a single operator< comparison and the loop body has no data-dependent
+ * early exit.
+ * 
+ * @param key The key to search for
+ * @return Iterator to the element, or end() if the key is absent
+ */
+template<class T, class Augment>
+typename Binary_Tree<T, Augment>::Const_Iterator Binary_Tree<T, Augment>::find(const T &key) const {
+    Node* candidate = lower_bound(key).curr;
+    return Const_Iterator((candidate != nullptr && !(key < candidate->data)) ? candidate : nullptr, this);
+}
+
+/**
+ * @brief Checks whether a key is stored in the tree
+ * 
+ * @param key The key to search for
+ * @return True if the key is present, false otherwise
+ */
+template<class T, class Augment>
+bool Binary_Tree<T, Augment>::contains(const T &key) const {
+    return find(key) != end();
+}
+
+/**
+ * @brief Finds the first element that is not less than the given key
+ * 
+ * Walks from the root remembering the last node where the search turned left.
+ * Both the candidate update and the child selection are written as conditional
+ * moves so the compiler can emit them without branches.
+ * 
+ * @param key The key to compare against
+ * @return Iterator to the first element >= key, or end() if there is none
+ */
+template<class T, class Augment>
+typename Binary_Tree<T, Augment>::Const_Iterator Binary_Tree<T, Augment>::lower_bound(const T &key) const {
+    Node* result = nullptr;
+    Node* curr = root;
+    while (curr != nullptr) {
+        const bool goRight = curr->data < key;
+        result = goRight ? result : curr;
+        curr = goRight ? curr->right : curr->left;
+    }
+    return Const_Iterator(result, this);
+}
+
+/**
+ * @brief Finds the first element that is greater than the given key
+ * 
+ * Same descent as lower_bound() with the comparison reversed.
+ * 
+ * @param key The key to compare against
+ * @return Iterator to the first element > key, or end() if there is none
+ */
+template<class T, class Augment>
+typename Binary_Tree<T, Augment>::Const_Iterator Binary_Tree<T, Augment>::upper_bound(const T &key) const {
+    Node* result = nullptr;
+    Node* curr = root;
+    while (curr != nullptr) {
+        const bool goRight = !(key < curr->data);
+        result = goRight ? result : curr;
+        curr = goRight ? curr->right : curr->left;
+    }
+    return Const_Iterator(result, this);
+}
+
+/**
+ * @brief Finds the range of elements equivalent to the given key
+ * 
+ * Since keys are unique, the upper bound is the successor of the lower bound when the
+ * key is present and the lower bound itself otherwise, which avoids a second descent.
+ * 
+ * @param key The key to search for
+ * @return Pair of lower_bound(key) and upper_bound(key)
+ */
+template<class T, class Augment>
+std::pair<typename Binary_Tree<T, Augment>::Const_Iterator, typename Binary_Tree<T, Augment>::Const_Iterator> Binary_Tree<T, Augment>::equal_range(const T &key) const {
+    Const_Iterator first = lower_bound(key);
+    if (first.curr == nullptr || key < first.curr->data) {
+        return {first, first};
+    }
+    return {first, Const_Iterator(findSuccessor(first.curr), this)};
+}
+
+/**
+ * @brief Calculates the height of a node
+ * 
+ * Returns -1 for nullptr nodes (empty subtrees) and the stored height
+ * for actual nodes. This convention allows for easy height calculations
+ * in the balancing logic.
+ * 
+ * @param ptr Pointer to the node (can be nullptr)
+ * @return Height of the node (-1 for nullptr, actual height otherwise)
+ */
+template<class T, class Augment>
+int Binary_Tree<T, Augment>::height(Node *ptr) {
+    return  (ptr == nullptr) ? -1 : ptr->height;
+}
+
+/**
+ * @brief Calculates the balance factor of a node
+ * 
+ * The balance factor is defined as: height(left subtree) - height(right subtree)
+ * For an AVL tree to be balanced, the absolute value of the balance factor
+ * must be ≤ 1 for all nodes.
+ * 
+ * @param ptr Pointer to the node (can be nullptr)
+ * @return Balance factor = height(left) - height(right)
+ */
+template<class T, class Augment>
+int Binary_Tree<T, Augment>::getBalance(Node *ptr) {
+    return (ptr == nullptr) ? -1 : height(ptr->left) - height(ptr->right);
+}
+
+/**
+ * @brief Performs a right rotation around the given node
+ * 
+ * Right rotation is used to balance the tree when the left subtree is too tall.
+ * The operation involves:
+ * 1. Making the left child (x) the new root of the subtree
+ * 2. Moving the original root (y) to be the right child of x
+ * 3. Moving x's right subtree (T2) to be y's left subtree
+ * 4. Updating all parent pointers and heights
+ * 
+ * @param y The node around which to perform the rotation
+ * @return Pointer to the new root of the rotated subtree
+ */
+template<class T, class Augment>
+typename Binary_Tree<T, Augment>::Node *Binary_Tree<T, Augment>::rightRotate(Node *y) {
+    if (y == nullptr || y->left == nullptr) {
+        return y;
+    }
+    
+    Node* x = y->left;
+    Node* T2 = x->right;
+
+    x->right = y;
+    x->parent = y->parent;
+    y->parent = x;
+    y->left = T2;
+
+    if (T2 != nullptr) {
+        T2->parent = y;
+    }
+
+    y->height = 1 + max(height(y->left), height(y->right));
+    x->height = 1 + max(height(x->left), height(x->right));
+    Augment::update(y);
+    Augment::update(x);
+
+    return x;
+}
+
+/**
+ * @brief Performs a left rotation around the given node
+ * 
+ * Left rotation is used to balance the tree when the right subtree is too tall.
+ * The operation involves:
+ * 1. Making the right child (y) the new root of the subtree
+ * 2. Moving the original root (x) to be the left child of y
+ * 3. Moving y's left subtree (T2) to be x's right subtree
+ * 4. Updating all parent pointers and heights
+ * 
+ * @param x The node around which to perform the rotation
+ * @return Pointer to the new root of the rotated subtree
+ */
+template<class T, class Augment>
+typename Binary_Tree<T, Augment>::Node *Binary_Tree<T, Augment>::leftRotate(Node *x) {
+    if (x == nullptr || x->right == nullptr) {
+        return x;
     }
-    else if (data > ptr->data) {
-        ptr->right = insert(ptr->right, data, ptr);
+    
+    Node* y = x->right;
+    Node* T2 = y->left;
+
+    y->left = x;
+    y->parent = x->parent;
+    x->parent = y;
+    x->right = T2;
+
+    if (T2 != nullptr) {
+        T2->parent = x;
+    }
+
+    x->height = 1 + max(height(x->left), height(x->right));
+    y->height = 1 + max(height(y->left), height(y->right));
+    Augment::update(x);
+    Augment::update(y);
+
+    return y;
+}
+
+/**
+ * @brief Public interface for inserting a new element into the tree
+ * 
+ * This is the main insertion method that users call to add elements to the tree.
+ * 
+ * @param data The data to insert into the tree
+ * @return Pair of an iterator to the element with the key and whether it was inserted
+ */
+template<class T, class Augment>
+std::pair<typename Binary_Tree<T, Augment>::Const_Iterator, bool> Binary_Tree<T, Augment>::insert(const T &data) {
+    std::pair<Node*, bool> result = insertUnique(data);
+    return {Const_Iterator(result.first, this), result.second};
+}
+
+/**
+ * @brief Inserts a new element into the tree, moving it into the new node
+ * 
+ * @param data The data to insert into the tree
+ * @return Pair of an iterator to the element with the key and whether it was inserted
+ */
+template<class T, class Augment>
+std::pair<typename Binary_Tree<T, Augment>::Const_Iterator, bool> Binary_Tree<T, Augment>::insert(T &&data) {
+    std::pair<Node*, bool> result = insertUnique(std::move(data));
+    return {Const_Iterator(result.first, this), result.second};
+}
+
+/**
+ * @brief Constructs an element in place and inserts it into the tree
+ * 
+ * The node has to exist before the descent since the key is only available once
+ * constructed. A duplicate node goes straight back to the arena's free list.
+ * 
+ * @param args Arguments forwarded to the constructor of T
+ * @return Pair of an iterator to the element with the key and whether it was inserted
+ */
+template<class T, class Augment>
+template<class... Args>
+std::pair<typename Binary_Tree<T, Augment>::Const_Iterator, bool> Binary_Tree<T, Augment>::emplace(Args &&... args) {
+    Node* node = nodes.create(std::forward<Args>(args)...);
+    Node* parent = nullptr;
+    Node* curr = root;
+    bool asLeft = false;
+
+    while (curr != nullptr) {
+        parent = curr;
+        if (node->data < curr->data) {
+            asLeft = true;
+            curr = curr->left;
+        }
+        else if (curr->data < node->data) {
+            asLeft = false;
+            curr = curr->right;
+        }
+        else {
+            nodes.destroy(node);
+            return {Const_Iterator(curr, this), false};
+        }
+    }
+
+    attach(parent, node, asLeft);
+    return {Const_Iterator(node, this), true};
+}
+
+/**
+ * @brief Inserts a key unless an equivalent one is present, copying or moving it once
+ * 
+ * The insertion runs top-down without recursion:
+ * 1. Descends from the root with operator< only, comparing against the caller's key
+ * 2. Stops at an equivalent key without allocating anything
+ * 3. Otherwise constructs the node from the forwarded key, which is the only copy
+ *    (or move) made, and attaches it under the last node visited
+ * 
+ * @param data The key to insert (const T& or T&&)
+ * @return Pair of the node holding the key and whether it was inserted
+ */
+template<class T, class Augment>
+template<class K>
+std::pair<typename Binary_Tree<T, Augment>::Node *, bool> Binary_Tree<T, Augment>::insertUnique(K &&data) {
+    Node* parent = nullptr;
+    Node* curr = root;
+    bool asLeft = false;
+
+    while (curr != nullptr) {
+        parent = curr;
+        if (data < curr->data) {
+            asLeft = true;
+            curr = curr->left;
+        }
+        else if (curr->data < data) {
+            asLeft = false;
+            curr = curr->right;
+        }
+        else {
+            return {curr, false};
+        }
+    }
+
+    Node* node = nodes.create(std::forward<K>(data));
+    attach(parent, node, asLeft);
+    return {node, true};
+}
+
+/**
+ * @brief Links a new leaf under a parent and rebalances the path above it
+ * 
+ * Retracing goes up from the parent, updating heights and rotating where needed.
+ * It stops at the first subtree whose height did not change: either the new leaf
+ * did not make it taller, or a single or double rotation restored its old height.
+ * At most one rotation (single or double) is ever performed per insertion.
+ * 
+ * @param parent The parent found by the descent (nullptr for an empty tree)
+ * @param node The new leaf
+ * @param asLeft True to link the leaf as the left child of parent
+ */
+template<class T, class Augment>
+void Binary_Tree<T, Augment>::attach(Node *parent, Node *node, bool asLeft) {
+    node->parent = parent;
+    Augment::update(node);
+    unsigned long long size = count.load(memory_order_relaxed);
+    if (size != UNKNOWN_SIZE) {
+        count.store(size + 1, memory_order_relaxed);
+    }
+    if (parent == nullptr) {
+        root = node;
+        return;
+    }
+
+    if (asLeft) {
+        parent->left = node;
     }
     else {
-        return ptr;
+        parent->right = node;
+    }
+    retrace(parent);
+}
+
+/**
+ * @brief Replaces a child pointer of a node, or the root if the node is nullptr
+ * 
+ * Links newChild where oldChild used to be and points newChild back at the parent.
+ * 
+ * @param parent Parent whose child pointer to update (nullptr for the root)
+ * @param oldChild The child currently linked under parent
+ * @param newChild The node to link in its place (can be nullptr)
+ */
+template<class T, class Augment>
+void Binary_Tree<T, Augment>::replaceChild(Node *parent, Node *oldChild, Node *newChild) {
+    if (parent == nullptr) {
+        root = newChild;
+    }
+    else if (parent->left == oldChild) {
+        parent->left = newChild;
+    }
+    else {
+        parent->right = newChild;
     }
 
+    if (newChild != nullptr) {
+        newChild->parent = parent;
+    }
+}
+
+/**
+ * @brief Updates the height of a node and rotates it if it is out of balance
+ * 
+ * Unlike the insertion path, the rotation case is chosen from the balance factor
+ * of the taller child, since after a deletion there is no inserted key to compare
+ * against. A child with balance 0 is handled by a single rotation.
+ * 
+ * @param ptr The node to rebalance
+ * @return Pointer to the new root of the subtree (not yet linked into the parent)
+ */
+template<class T, class Augment>
+typename Binary_Tree<T, Augment>::Node *Binary_Tree<T, Augment>::rebalance(Node *ptr) {
     ptr->height = 1 + max(height(ptr->left), height(ptr->right));
-    const int balance =  getBalance(ptr);
+    Augment::update(ptr);
+    const int balance = getBalance(ptr);
 
-    // Left-Left Case
-    if (balance > 1 && ptr->left && data < ptr->left->data) {
+    if (balance > 1) {
+        if (getBalance(ptr->left) < 0) {
+            ptr->left = leftRotate(ptr->left);
+        }
         return rightRotate(ptr);
     }
 
-    // Right-Right Case
-    if (balance < -1 && ptr->right && data > ptr->right->data) {
+    if (balance < -1) {
+        if (getBalance(ptr->right) > 0) {
+            ptr->right = rightRotate(ptr->right);
+        }
         return leftRotate(ptr);
     }
 
-    // Left-Right Case
-    if (balance > 1 && ptr->left && data > ptr->left->data) {
-        ptr->left = leftRotate(ptr->left);
-        return rightRotate(ptr);
+    return ptr;
+}
+
+/**
+ * @brief Restores heights and balance from a node up towards the root
+ * 
+ * Each node on the path is rebalanced and relinked into its parent. Once a subtree
+ * ends up with the same height it had before, no ancestor can change either, so the
+ * walk stops there instead of continuing to the root.
+ * 
+ * @param ptr The lowest node whose subtree changed
+ */
+template<class T, class Augment>
+void Binary_Tree<T, Augment>::retrace(Node *ptr) {
+    while (ptr != nullptr) {
+        const int oldHeight = ptr->height;
+        Node* parent = ptr->parent;
+        Node* subtree = rebalance(ptr);
+        if (subtree != ptr) {
+            replaceChild(parent, ptr, subtree);
+        }
+        if (subtree->height == oldHeight) {
+            // Heights above are settled, but augmented data still changes up to the root
+            if constexpr (Augment::ENABLED) {
+                for (Node* ancestor = parent; ancestor != nullptr; ancestor = ancestor->parent) {
+                    Augment::update(ancestor);
+                }
+            }
+            return;
+        }
+        ptr = parent;
     }
+}
 
-    // Right-Left Case
-    if (balance < -1 && ptr->right && data < ptr->right->data) {
-        ptr->right = rightRotate(ptr->right);
-        return leftRotate(ptr);
+/**
+ * @brief Removes a key from the tree
+ * 
+ * @param key The key to remove
+ * @return True if the key was removed, false if it was not present
+ */
+template<class T, class Augment>
+bool Binary_Tree<T, Augment>::erase(const T &key) {
+    Node* ptr = find(key).curr;
+    if (ptr == nullptr) {
+        return false;
     }
+    erase(ptr);
+    return true;
+}
 
-    return ptr;
+/**
+ * @brief Removes a node from the tree
+ * 
+ * The node is unlinked structurally:
+ * 1. With at most one child, the child takes the node's place
+ * 2. With two children, the in-order successor (the minimum of the right subtree)
+ *    is detached and moved into the node's place, inheriting its height
+ * 
+ * Retracing then starts at the lowest node whose subtree lost height and stops early
+ * as soon as a height is unchanged, so the removal costs O(log n) with O(1) rotations
+ * in the common case.
+ * 
+ * @param ptr Node to remove
+ * @return Pointer to the successor of the removed node, or nullptr if there is none
+ * @throws std::invalid_argument if ptr is nullptr
+ */
+template<class T, class Augment>
+typename Binary_Tree<T, Augment>::Node *Binary_Tree<T, Augment>::erase(Node *ptr) {
+    if (ptr == nullptr) {
+        throw std::invalid_argument("Cannot erase a null node");
+    }
+
+    Node* successor = findSuccessor(ptr);
+    Node* retraceFrom;
+
+    if (ptr->left == nullptr || ptr->right == nullptr) {
+        Node* child = (ptr->left != nullptr) ? ptr->left : ptr->right;
+        retraceFrom = ptr->parent;
+        replaceChild(ptr->parent, ptr, child);
+    }
+    else {
+        // successor is the minimum of the right subtree, so it has no left child
+        if (successor->parent == ptr) {
+            retraceFrom = successor;
+        }
+        else {
+            retraceFrom = successor->parent;
+            replaceChild(successor->parent, successor, successor->right);
+            successor->right = ptr->right;
+            successor->right->parent = successor;
+        }
+        successor->left = ptr->left;
+        successor->left->parent = successor;
+        successor->height = ptr->height;
+        replaceChild(ptr->parent, ptr, successor);
+    }
+
+    nodes.destroy(ptr);
+    unsigned long long size = count.load(memory_order_relaxed);
+    if (size != UNKNOWN_SIZE) {
+        count.store(size - 1, memory_order_relaxed);
+    }
+    retrace(retraceFrom);
+    return successor;
+}
+
+/**
+ * @brief Removes the element an iterator points to
+ * 
+ * @param pos Iterator to the element to remove. Must not be end().
+ * @return Iterator to the element that followed the removed one
+ * @throws std::runtime_error if pos is end()
+ */
+template<class T, class Augment>
+typename Binary_Tree<T, Augment>::Iterator Binary_Tree<T, Augment>::erase(Iterator pos) {
+    if (pos.curr == nullptr) {
+        throw std::runtime_error("Cannot erase end() iterator");
+    }
+    return Iterator(erase(pos.curr), this);
+}
+
+/**
+ * @brief Counts the elements less than a key
+ * 
+ * Descends as lower_bound() does and, every time the search goes right, adds the
+ * node and its left subtree to the count.
+ * 
+ * @param key The key to compare against
+ * @return Number of stored elements that are less than key
+ */
+template<class T, class Augment>
+unsigned long long Binary_Tree<T, Augment>::rank(const T &key) const {
+    static_assert(Augment::ORDER_STATISTICS, "rank() requires the Order_Statistics policy");
+    unsigned long long result = 0;
+    Node* curr = root;
+    while (curr != nullptr) {
+        if (curr->data < key) {
+            result += Augment::size_of(curr->left) + 1;
+            curr = curr->right;
+        }
+        else {
+            curr = curr->left;
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Finds the element at a position in sorted order
+ * 
+ * At each node the size of the left subtree tells whether position k lies to the
+ * left, at the node itself, or to the right (where k is reduced accordingly).
+ * 
+ * @param k Zero-based position in sorted order
+ * @return Iterator to the element
+ * @throws std::out_of_range if k >= get_size()
+ */
+template<class T, class Augment>
+typename Binary_Tree<T, Augment>::Const_Iterator Binary_Tree<T, Augment>::select(unsigned long long k) const {
+    static_assert(Augment::ORDER_STATISTICS, "select() requires the Order_Statistics policy");
+    if (k >= get_size()) {
+        throw std::out_of_range("Index out of range in select()");
+    }
+    Node* curr = root;
+    while (true) {
+        const unsigned long long leftSize = Augment::size_of(curr->left);
+        if (k < leftSize) {
+            curr = curr->left;
+        }
+        else if (k == leftSize) {
+            return Const_Iterator(curr, this);
+        }
+        else {
+            k -= leftSize + 1;
+            curr = curr->right;
+        }
+    }
+}
+
+/**
+ * @brief Counts the elements in a closed key range
+ * 
+ * Counts the elements not greater than hi in one descent and subtracts rank(lo).
+ * 
+ * @param lo Smallest key of the range
+ * @param hi Largest key of the range
+ * @return Number of stored elements x with lo <= x <= hi (0 if hi < lo)
+ */
+template<class T, class Augment>
+unsigned long long Binary_Tree<T, Augment>::count_range(const T &lo, const T &hi) const {
+    static_assert(Augment::ORDER_STATISTICS, "count_range() requires the Order_Statistics policy");
+    if (hi < lo) return 0;
+    unsigned long long notGreater = 0;
+    Node* curr = root;
+    while (curr != nullptr) {
+        if (hi < curr->data) {
+            curr = curr->left;
+        }
+        else {
+            notGreater += Augment::size_of(curr->left) + 1;
+            curr = curr->right;
+        }
+    }
+    return notGreater - rank(lo);
+}
+
+/**
+ * @brief Aggregates the elements in a closed key range
+ * 
+ * Descends to the highest node inside [lo, hi], where the search paths for lo and
+ * hi split. Below it, the path towards lo picks up every node >= lo together with
+ * its right subtree aggregate, and the path towards hi picks up every node <= hi
+ * together with its left subtree aggregate. The pieces are combined in key order,
+ * so the monoid does not need to be commutative.
+ * 
+ * @param lo Smallest key of the range
+ * @param hi Largest key of the range
+ * @return The aggregate of every x with lo <= x <= hi
+ */
+template<class T, class Augment>
+template<class Policy>
+typename Policy::value_type Binary_Tree<T, Augment>::aggregate(const T &lo, const T &hi) const {
+    static_assert(Policy::AGGREGATES, "aggregate() requires a Monoid_Augment policy");
+    using Monoid = typename Policy::monoid_type;
+
+    if (hi < lo) return Monoid::identity();
+
+    Node* split = root;
+    while (split != nullptr && (split->data < lo || hi < split->data)) {
+        split = (split->data < lo) ? split->right : split->left;
+    }
+    if (split == nullptr) return Monoid::identity();
+
+    // Pieces below split on the lo side are found from right to left, so prepend them
+    typename Policy::value_type low = Monoid::identity();
+    for (Node* curr = split->left; curr != nullptr;) {
+        if (curr->data < lo) {
+            curr = curr->right;
+        }
+        else {
+            low = Monoid::combine(Monoid::combine(Monoid::lift(curr->data), Policy::aggregate_of(curr->right)), low);
+            curr = curr->left;
+        }
+    }
+
+    // Pieces on the hi side are found from left to right, so append them
+    typename Policy::value_type high = Monoid::identity();
+    for (Node* curr = split->right; curr != nullptr;) {
+        if (hi < curr->data) {
+            curr = curr->left;
+        }
+        else {
+            high = Monoid::combine(high, Monoid::combine(Policy::aggregate_of(curr->left), Monoid::lift(curr->data)));
+            curr = curr->right;
+        }
+    }
+
+    return Monoid::combine(Monoid::combine(low, Monoid::lift(split->data)), high);
+}
+
+/**
+ * @brief Aggregates every element of the tree
+ * 
+ * @return The aggregate stored at the root (the identity if the tree is empty)
+ */
+template<class T, class Augment>
+template<class Policy>
+typename Policy::value_type Binary_Tree<T, Augment>::aggregate() const {
+    static_assert(Policy::AGGREGATES, "aggregate() requires a Monoid_Augment policy");
+    return Policy::aggregate_of(root);
+}
+
+/**
+ * @brief Makes a node the parent of two subtrees and updates its height and policy data
+ * 
+ * @param node The node to link (its parent is left unchanged)
+ * @param left New left subtree (can be nullptr)
+ * @param right New right subtree (can be nullptr)
+ */
+template<class T, class Augment>
+void Binary_Tree<T, Augment>::link(Node *node, Node *left, Node *right) {
+    node->left = left;
+    node->right = right;
+    if (left != nullptr) left->parent = node;
+    if (right != nullptr) right->parent = node;
+    node->height = 1 + max(height(left), height(right));
+    Augment::update(node);
+}
+
+/**
+ * @brief Detaches the children of a node
+ * 
+ * @param node The node to detach
+ * @param left Output: the former left subtree, with no parent
+ * @param right Output: the former right subtree, with no parent
+ */
+template<class T, class Augment>
+void Binary_Tree<T, Augment>::detach(Node *node, Node *&left, Node *&right) {
+    left = node->left;
+    right = node->right;
+    if (left != nullptr) left->parent = nullptr;
+    if (right != nullptr) right->parent = nullptr;
+    node->left = nullptr;
+    node->right = nullptr;
+    node->parent = nullptr;
+}
+
+/**
+ * @brief Joins two detached subtrees around a middle node
+ * 
+ * If the heights differ by at most one, the middle node simply becomes the new root.
+ * Otherwise the shorter subtree is hung off the facing spine of the taller one at the
+ * first node no more than one level taller than it, and the spine is rebalanced on
+ * the way back up. The cost is O(|height(left) - height(right)| + 1).
+ * 
+ * @param left Subtree whose keys are all less than the middle key (can be nullptr)
+ * @param middle Detached node holding the middle key
+ * @param right Subtree whose keys are all greater than the middle key (can be nullptr)
+ * @return Root of the balanced result, with no parent
+ */
+template<class T, class Augment>
+typename Binary_Tree<T, Augment>::Node *Binary_Tree<T, Augment>::joinNodes(Node *left, Node *middle, Node *right) {
+    Node* top;
+    if (height(left) > height(right) + 1) {
+        top = joinRight(left, middle, right);
+    }
+    else if (height(right) > height(left) + 1) {
+        top = joinLeft(left, middle, right);
+    }
+    else {
+        link(middle, left, right);
+        top = middle;
+    }
+    top->parent = nullptr;
+    return top;
+}
+
+/**
+ * @brief Joins along the right spine of a subtree taller than the other by two or more
+ * 
+ * Descends the right spine of left until the subtree there is at most one level taller
+ * than right, puts the middle node above the two, and rebalances each spine node on
+ * the way back. At most one rotation (single or double) changes the shape.
+ * 
+ * @param left The taller subtree
+ * @param middle Detached node holding the middle key
+ * @param right The shorter subtree
+ * @return Root of the result (its parent is that of left)
+ */
+template<class T, class Augment>
+typename Binary_Tree<T, Augment>::Node *Binary_Tree<T, Augment>::joinRight(Node *left, Node *middle, Node *right) {
+    Node* spine = left->right;
+    Node* joined;
+    if (height(spine) <= height(right) + 1) {
+        link(middle, spine, right);
+        joined = middle;
+    }
+    else {
+        joined = joinRight(spine, middle, right);
+    }
+    left->right = joined;
+    joined->parent = left;
+    return rebalance(left);
+}
+
+/**
+ * @brief Joins along the left spine of a subtree taller than the other by two or more
+ * 
+ * Mirror image of joinRight().
+ * 
+ * @param left The shorter subtree
+ * @param middle Detached node holding the middle key
+ * @param right The taller subtree
+ * @return Root of the result (its parent is that of right)
+ */
+template<class T, class Augment>
+typename Binary_Tree<T, Augment>::Node *Binary_Tree<T, Augment>::joinLeft(Node *left, Node *middle, Node *right) {
+    Node* spine = right->left;
+    Node* joined;
+    if (height(spine) <= height(left) + 1) {
+        link(middle, left, spine);
+        joined = middle;
+    }
+    else {
+        joined = joinLeft(left, middle, spine);
+    }
+    right->left = joined;
+    joined->parent = right;
+    return rebalance(right);
+}
+
+/**
+ * @brief Joins two detached subtrees without a middle node
+ * 
+ * The largest node of left is taken out and used as the middle node.
+ * 
+ * @param left Subtree whose keys are all less than those of right (can be nullptr)
+ * @param right The other subtree (can be nullptr)
+ * @return Root of the balanced result, with no parent
+ */
+template<class T, class Augment>
+typename Binary_Tree<T, Augment>::Node *Binary_Tree<T, Augment>::joinPair(Node *left, Node *right) {
+    if (left == nullptr) return right;
+    if (right == nullptr) return left;
+    Node* last;
+    Node* rest = splitLast(left, last);
+    return joinNodes(rest, last, right);
+}
+
+/**
+ * @brief Removes the largest node of a detached subtree
+ * 
+ * Follows the right spine down, then joins every spine node back with its left
+ * subtree on the way up. O(log n).
+ * 
+ * @param top Root of a non-empty subtree
+ * @param last Output: the removed node, detached
+ * @return Root of the remaining subtree, with no parent
+ */
+template<class T, class Augment>
+typename Binary_Tree<T, Augment>::Node *Binary_Tree<T, Augment>::splitLast(Node *top, Node *&last) {
+    Node* left;
+    Node* right;
+    detach(top, left, right);
+    if (right == nullptr) {
+        last = top;
+        return left;
+    }
+    Node* rest = splitLast(right, last);
+    return joinNodes(left, top, rest);
+}
+
+/**
+ * @brief Splits a detached subtree around a key
+ * 
+ * Descends towards the key, detaching every node on the path. On the way back up each
+ * of them is joined with its off-path subtree into the less or greater side. Each join
+ * costs the height difference of its operands, and those differences telescope along
+ * the path, so the whole split is O(log n).
+ * 
+ * @param top Root of the subtree (can be nullptr)
+ * @param key The key to split at
+ * @param less Output: subtree of the keys less than key, with no parent
+ * @param greater Output: subtree of the keys greater than key, with no parent
+ * @return The detached node holding an equivalent key, or nullptr if there is none
+ */
+template<class T, class Augment>
+typename Binary_Tree<T, Augment>::Node *Binary_Tree<T, Augment>::splitNode(Node *top, const T &key, Node *&less, Node *&greater) {
+    if (top == nullptr) {
+        less = nullptr;
+        greater = nullptr;
+        return nullptr;
+    }
+
+    Node* left;
+    Node* right;
+    detach(top, left, right);
+    if (key < top->data) {
+        Node* found = splitNode(left, key, less, greater);
+        greater = joinNodes(greater, top, right);
+        return found;
+    }
+    if (top->data < key) {
+        Node* found = splitNode(right, key, less, greater);
+        less = joinNodes(left, top, less);
+        return found;
+    }
+    less = left;
+    greater = right;
+    link(top, nullptr, nullptr);
+    return top;
+}
+
+/**
+ * @brief Computes the union of two detached subtrees, keeping the nodes of a on ties
+ * 
+ * @param a Root of the first subtree
+ * @param b Root of the second subtree
+ * @param state Collects duplicate nodes of b and counts them
+ * @param spawn Remaining levels of recursion allowed to fork onto new threads
+ * @return Root of the result, with no parent
+ */
+template<class T, class Augment>
+typename Binary_Tree<T, Augment>::Node *Binary_Tree<T, Augment>::uniteNodes(Node *a, Node *b, Merge_State &state, unsigned spawn) {
+    if (a == nullptr) return b;
+    if (b == nullptr) return a;
+
+    const bool parallel = spawn > 0 && max(height(a), height(b)) >= PARALLEL_HEIGHT;
+    Node* left;
+    Node* right;
+    detach(a, left, right);
+    Node* less;
+    Node* greater;
+    Node* found = splitNode(b, a->data, less, greater);
+    if (found != nullptr) {
+        state.discarded.push_back(found);
+        ++state.matched;
+    }
+
+    forkJoin(parallel, state,
+             [&](Merge_State& branch) { left = uniteNodes(left, less, branch, spawn - parallel); },
+             [&](Merge_State& branch) { right = uniteNodes(right, greater, branch, spawn - parallel); });
+    return joinNodes(left, a, right);
+}
+
+/**
+ * @brief Computes the intersection of two detached subtrees, keeping the nodes of a
+ * 
+ * @param a Root of the first subtree
+ * @param b Root of the second subtree
+ * @param state Collects every node left out and counts the common keys
+ * @param spawn Remaining levels of recursion allowed to fork onto new threads
+ * @return Root of the result, with no parent
+ */
+template<class T, class Augment>
+typename Binary_Tree<T, Augment>::Node *Binary_Tree<T, Augment>::intersectNodes(Node *a, Node *b, Merge_State &state, unsigned spawn) {
+    if (a == nullptr || b == nullptr) {
+        if (a != nullptr) state.discarded.push_back(a);
+        if (b != nullptr) state.discarded.push_back(b);
+        return nullptr;
+    }
+
+    const bool parallel = spawn > 0 && max(height(a), height(b)) >= PARALLEL_HEIGHT;
+    Node* left;
+    Node* right;
+    detach(a, left, right);
+    Node* less;
+    Node* greater;
+    Node* found = splitNode(b, a->data, less, greater);
+
+    forkJoin(parallel, state,
+             [&](Merge_State& branch) { left = intersectNodes(left, less, branch, spawn - parallel); },
+             [&](Merge_State& branch) { right = intersectNodes(right, greater, branch, spawn - parallel); });
+    if (found != nullptr) {
+        state.discarded.push_back(found);
+        ++state.matched;
+        return joinNodes(left, a, right);
+    }
+    state.discarded.push_back(a);
+    return joinPair(left, right);
+}
+
+/**
+ * @brief Removes the keys of one detached subtree from another
+ * 
+ * @param a Root of the subtree to subtract from
+ * @param b Root of the subtree of keys to remove
+ * @param state Collects every node left out and counts the keys removed from a
+ * @param spawn Remaining levels of recursion allowed to fork onto new threads
+ * @return Root of the result, with no parent
+ */
+template<class T, class Augment>
+typename Binary_Tree<T, Augment>::Node *Binary_Tree<T, Augment>::subtractNodes(Node *a, Node *b, Merge_State &state, unsigned spawn) {
+    if (a == nullptr || b == nullptr) {
+        if (b != nullptr) state.discarded.push_back(b);
+        return a;
+    }
+
+    const bool parallel = spawn > 0 && max(height(a), height(b)) >= PARALLEL_HEIGHT;
+    Node* left;
+    Node* right;
+    detach(b, left, right);
+    Node* less;
+    Node* greater;
+    Node* found = splitNode(a, b->data, less, greater);
+    state.discarded.push_back(b);
+    if (found != nullptr) {
+        state.discarded.push_back(found);
+        ++state.matched;
+    }
+
+    forkJoin(parallel, state,
+             [&](Merge_State& branch) { less = subtractNodes(less, left, branch, spawn - parallel); },
+             [&](Merge_State& branch) { greater = subtractNodes(greater, right, branch, spawn - parallel); });
+    return joinPair(less, greater);
+}
+
+/**
+ * @brief Runs the two recursive halves of a set operation, the second on a new thread if allowed
+ * 
+ * The halves work on disjoint subtrees and never touch the arena, so the only
+ * state to combine afterwards is each branch's Merge_State. If the system refuses
+ * to start another thread, both halves run on the calling thread instead.
+ * 
+ * @param parallel True to run the halves concurrently
+ * @param state Bookkeeping of the calling branch; the new thread's is merged into it
+ * @param lower Callable taking Merge_State&, run on the calling thread
+ * @param upper Callable taking Merge_State&
+ */
+template<class T, class Augment>
+template<class Lower, class Upper>
+void Binary_Tree<T, Augment>::forkJoin(bool parallel, Merge_State &state, Lower &&lower, Upper &&upper) {
+    if (!parallel) {
+        lower(state);
+        upper(state);
+        return;
+    }
+
+    Merge_State branch;
+    future<void> pending;
+    try {
+        pending = async(launch::async, [&] { upper(branch); });
+    }
+    catch (const system_error&) {
+        // No thread could be started; the subtrees are still attached, so recurse here
+        lower(state);
+        upper(state);
+        return;
+    }
+    try {
+        lower(state);
+    }
+    catch (...) {
+        pending.wait();
+        throw;
+    }
+    pending.get();
+    state.discarded.insert(state.discarded.end(), branch.discarded.begin(), branch.discarded.end());
+    state.matched += branch.matched;
+}
+
+/**
+ * @brief Returns how many levels of a set operation may fork onto new threads
+ * 
+ * One level more than needed to give every hardware thread a branch, so that uneven
+ * splits still keep all of them busy.
+ * 
+ * @return About log2 of the hardware thread count plus one, or 0 on a single core
+ */
+template<class T, class Augment>
+unsigned Binary_Tree<T, Augment>::fanOut() {
+    const unsigned threads = thread::hardware_concurrency();
+    if (threads <= 1) return 0;
+    unsigned levels = 1;
+    while ((1u << levels) < threads) {
+        ++levels;
+    }
+    return levels + 1;
+}
+
+/**
+ * @brief Destroys every node of a detached subtree, returning the slots to the arena
+ * 
+ * Uses the same rotate-and-peel walk as clear(), so no recursion or stack is needed.
+ * 
+ * @param top Root of the subtree (can be nullptr)
+ */
+template<class T, class Augment>
+void Binary_Tree<T, Augment>::destroySubtree(Node *top) {
+    Node* curr = top;
+    while (curr != nullptr) {
+        if (curr->left != nullptr) {
+            Node* left = curr->left;
+            curr->left = left->right;
+            left->right = curr;
+            curr = left;
+        }
+        else {
+            Node* next = curr->right;
+            nodes.destroy(curr);
+            curr = next;
+        }
+    }
+}
+
+/**
+ * @brief Destroys the nodes a set operation left out
+ * 
+ * @param state The bookkeeping of the finished operation
+ */
+template<class T, class Augment>
+void Binary_Tree<T, Augment>::discard(Merge_State &state) {
+    for (Node* top : state.discarded) {
+        destroySubtree(top);
+    }
+    state.discarded.clear();
+}
+
+/**
+ * @brief Joins two trees around a middle key
+ * 
+ * The middle node is created first and the storage of right is absorbed into that of
+ * left, which are the only steps that can throw; after that the trees are relinked
+ * with joinNodes() and nothing is copied.
+ * 
+ * @param left Tree whose keys are all less than key; left empty
+ * @param key The middle key, copied into the result
+ * @param right Tree whose keys are all greater than key; left empty
+ * @return A tree holding every key of left, key and every key of right
+ * @throws std::invalid_argument if the keys are not in that order; both trees are unchanged
+ */
+template<class T, class Augment>
+Binary_Tree<T, Augment> Binary_Tree<T, Augment>::join(Binary_Tree &&left, const T &key, Binary_Tree &&right) {
+    if ((left.root != nullptr && !(findMax(left.root)->data < key)) ||
+        (right.root != nullptr && !(key < findMin(right.root)->data))) {
+        throw std::invalid_argument("Keys are not in order in join()");
+    }
+
+    Node* middle = left.nodes.create(key);
+    try {
+        left.nodes.absorb(right.nodes);
+    }
+    catch (...) {
+        left.nodes.destroy(middle);
+        throw;
+    }
+    const unsigned long long leftSize = left.count.load(memory_order_relaxed);
+    const unsigned long long rightSize = right.count.load(memory_order_relaxed);
+    const bool known = leftSize != UNKNOWN_SIZE && rightSize != UNKNOWN_SIZE;
+    const unsigned long long total = known ? leftSize + rightSize + 1 : UNKNOWN_SIZE;
+
+    Binary_Tree result(std::move(left));
+    result.root = result.joinNodes(result.root, middle, right.root);
+    result.count.store(total, memory_order_relaxed);
+    right.root = nullptr;
+    right.count.store(0, memory_order_relaxed);
+    return result;
+}
+
+/**
+ * @brief Splits a tree around a key
+ * 
+ * The storage is shared between the halves before anything is relinked. A node
+ * holding the key itself is joined back as the smallest key of the upper half.
+ * 
+ * @param tree The tree to split; left empty
+ * @param key The key to split at
+ * @return Pair of a tree holding the keys less than key and a tree holding the rest
+ */
+template<class T, class Augment>
+std::pair<Binary_Tree<T, Augment>, Binary_Tree<T, Augment>> Binary_Tree<T, Augment>::split(Binary_Tree &&tree, const T &key) {
+    std::pair<Binary_Tree, Binary_Tree> halves;
+    halves.second.nodes = tree.nodes.share();
+    halves.first = std::move(tree);
+
+    Binary_Tree& lower = halves.first;
+    Binary_Tree& upper = halves.second;
+    Node* less;
+    Node* greater;
+    Node* found = lower.splitNode(lower.root, key, less, greater);
+    if (found != nullptr) {
+        greater = lower.joinNodes(nullptr, found, greater);
+    }
+    lower.root = less;
+    upper.root = greater;
+    lower.count.store((less == nullptr) ? 0 : UNKNOWN_SIZE, memory_order_relaxed);
+    upper.count.store((greater == nullptr) ? 0 : UNKNOWN_SIZE, memory_order_relaxed);
+    return halves;
+}
+
+/**
+ * @brief Computes the union of two trees
+ * 
+ * The storage of b is absorbed into that of a up front, so every recursive step only
+ * relinks nodes and the result owns all of them. Duplicate nodes of b are destroyed
+ * at the end.
+ * 
+ * @param a The first tree; left empty
+ * @param b The second tree; left empty
+ * @return A tree holding every key of either tree, keeping the element of a on ties
+ */
+template<class T, class Augment>
+Binary_Tree<T, Augment> Binary_Tree<T, Augment>::set_union(Binary_Tree &&a, Binary_Tree &&b) {
+    Binary_Tree result(std::move(a));
+    if (&a == &b) return result;
+
+    const unsigned long long resultSize = result.count.load(memory_order_relaxed);
+    const unsigned long long otherSize = b.count.load(memory_order_relaxed);
+    const bool known = resultSize != UNKNOWN_SIZE && otherSize != UNKNOWN_SIZE;
+    const unsigned long long total = resultSize + otherSize;
+    result.nodes.absorb(b.nodes);
+    Node* other = b.root;
+    b.root = nullptr;
+    b.count.store(0, memory_order_relaxed);
+
+    Merge_State state;
+    result.root = result.uniteNodes(result.root, other, state, fanOut());
+    result.count.store(known ? total - state.matched : UNKNOWN_SIZE, memory_order_relaxed);
+    result.discard(state);
+    return result;
+}
+
+/**
+ * @brief Computes the intersection of two trees
+ * 
+ * @param a The first tree; left empty
+ * @param b The second tree; left empty
+ * @return A tree holding the keys present in both trees, as stored in a
+ */
+template<class T, class Augment>
+Binary_Tree<T, Augment> Binary_Tree<T, Augment>::set_intersection(Binary_Tree &&a, Binary_Tree &&b) {
+    Binary_Tree result(std::move(a));
+    if (&a == &b) return result;
+
+    result.nodes.absorb(b.nodes);
+    Node* other = b.root;
+    b.root = nullptr;
+    b.count.store(0, memory_order_relaxed);
+
+    Merge_State state;
+    result.root = result.intersectNodes(result.root, other, state, fanOut());
+    result.count.store(state.matched, memory_order_relaxed);
+    result.discard(state);
+    return result;
+}
+
+/**
+ * @brief Computes the difference of two trees
+ * 
+ * @param a The tree to subtract from; left empty
+ * @param b The keys to remove; left empty
+ * @return A tree holding the keys of a that are not in b
+ */
+template<class T, class Augment>
+Binary_Tree<T, Augment> Binary_Tree<T, Augment>::set_difference(Binary_Tree &&a, Binary_Tree &&b) {
+    Binary_Tree result(std::move(a));
+    if (&a == &b) {
+        result.clear();
+        return result;
+    }
+
+    const unsigned long long total = result.count.load(memory_order_relaxed);
+    result.nodes.absorb(b.nodes);
+    Node* other = b.root;
+    b.root = nullptr;
+    b.count.store(0, memory_order_relaxed);
+
+    Merge_State state;
+    result.root = result.subtractNodes(result.root, other, state, fanOut());
+    result.count.store((total != UNKNOWN_SIZE) ? total - state.matched : UNKNOWN_SIZE, memory_order_relaxed);
+    result.discard(state);
+    return result;
 }
@@ -0,0 +1,178 @@
+/**
+ * @file Node_Arena.h
+ * @brief Declaration of a slab allocator for fixed-size tree nodes.
+ */
+
+#ifndef NODE_ARENA_H
+#define NODE_ARENA_H
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+/**
+ * @class Node_Arena
+ * @brief A slab allocator that hands out node-sized slots carved from large blocks.
+ *
+ * Blocks start at FIRST_BLOCK slots and double up to MAX_BLOCK slots, so n nodes take
+ * O(log n) allocations while they grow and about n / MAX_BLOCK once they are large.
+ * Slots returned with destroy() go onto an intrusive free list and are reused before
+ * the current block is bumped. clear() gives every block back at once without touching
+ * individual slots; the owner must destroy live nodes with a non-trivial destructor first.
+ *
+ * Blocks are grouped into reference-counted chains, so nodes can change owners without
+ * being copied: absorb() takes over the blocks of another arena and share() lets a second
+ * arena keep them alive too. A chain is freed when the last arena holding it lets go.
+ * Each arena keeps its own free list and only allocates into a chain no other arena holds,
+ * so arenas sharing blocks can still be used from different threads.
+ *
+ * @tparam Node The node type to allocate.
+ */
+template <class Node>
+class Node_Arena {
+public:
+    static constexpr unsigned long long FIRST_BLOCK = 64;       ///< Slots in the first block.
+    static constexpr unsigned long long MAX_BLOCK = 1ULL << 20; ///< Upper bound on slots per block.
+
+private:
+    /**
+     * @union slot
+     * @brief Storage for one node, or a link in the free list while unused.
+     */
+    union slot {
+        slot* next;                                        ///< Next free slot, or the previous block in a block's first slot.
+        alignas(Node) unsigned char storage[sizeof(Node)]; ///< Raw storage for a node.
+    };
+
+    /**
+     * @struct chain
+     * @brief A list of blocks released together once no arena refers to them.
+     */
+    struct chain {
+        slot* newest = nullptr;             ///< Most recent block; its first slot links to the previous one.
+        unsigned long long block_count = 0; ///< Number of blocks in the chain.
+
+        /**
+         * @brief Frees every block of the chain.
+         */
+        ~chain();
+    };
+
+    std::shared_ptr<chain> owned;               ///< Chain this arena allocates into; held by no other arena.
+    std::vector<std::shared_ptr<chain>> shared; ///< Chains adopted from or shared with other arenas.
+    slot* cursor;                   ///< Next never-used slot of the most recent block.
+    slot* limit;                    ///< One past the last slot of the most recent block.
+    slot* free_list;                ///< Slots released by destroy().
+    slot* free_tail;                ///< Last slot of the free list, so another list can be appended.
+    unsigned long long next_block;  ///< Slot count of the next block to allocate.
+
+    /**
+     * @brief Puts a slot on the free list.
+     * @param released The slot to release.
+     */
+    void release(slot* released);
+    /**
+     * @brief Allocates a block and makes it the current one.
+     * @param slots The number of node slots in the block.
+     */
+    void allocate_block(unsigned long long slots);
+    /**
+     * @brief Returns an unused slot, allocating a new block if necessary.
+     * @return Pointer to the slot.
+     */
+    slot* acquire();
+
+public:
+    /**
+     * @brief Default constructor. Creates an empty arena without allocating.
+     */
+    Node_Arena();
+    /**
+     * @brief Destructor. Lets go of every block without running node destructors.
+     */
+    ~Node_Arena();
+    /**
+     * @brief Copying is disabled: nodes belong to exactly one arena.
+     */
+    Node_Arena(const Node_Arena&) = delete;
+    /**
+     * @brief Copy assignment is disabled: nodes belong to exactly one arena.
+     */
+    Node_Arena& operator=(const Node_Arena&) = delete;
+    /**
+     * @brief Move constructor. Takes over the blocks of another arena.
+     * @param other The arena to move from; left empty.
+     */
+    Node_Arena(Node_Arena&& other) noexcept;
+    /**
+     * @brief Move assignment operator. Frees this arena's blocks and takes over the other's.
+     * @param other The arena to move from; left empty.
+     * @return Reference to this arena.
+     */
+    Node_Arena& operator=(Node_Arena&& other) noexcept;
+    /**
+     * @brief Exchanges the contents of two arenas.
+     * @param other The arena to swap with.
+     */
+    void swap(Node_Arena& other) noexcept;
+    /**
+     * @brief Returns the number of blocks held, including blocks shared with other arenas.
+     * @return The number of blocks.
+     */
+    [[nodiscard]] unsigned long long get_block_count() const;
+    /**
+     * @brief Makes sure the next n nodes can be created without another allocation.
+     *
+     * If the current block does not have n never-used slots left, its remaining slots
+     * are moved to the free list and a single block of exactly n slots is allocated,
+     * regardless of MAX_BLOCK.
+     *
+     * @param n The number of nodes about to be created.
+     */
+    void reserve(unsigned long long n);
+    /**
+     * @brief Constructs a node in an unused slot.
+     * @tparam Args Constructor argument types.
+     * @param args Arguments forwarded to the node constructor.
+     * @return Pointer to the new node.
+     */
+    template <class... Args>
+    Node* create(Args&&... args);
+    /**
+     * @brief Destroys a node and puts its slot on the free list.
+     * @param node A node created by this arena.
+     */
+    void destroy(Node* node);
+    /**
+     * @brief Takes over every block and free slot of another arena.
+     *
+     * Nodes created by other become nodes of this arena and can be destroyed through it.
+     * The never-used tail of the other's current block is only kept if this arena has
+     * none of its own. O(number of chains); this arena is unchanged if an exception is thrown.
+     *
+     * @param other The arena to absorb; left empty.
+     */
+    void absorb(Node_Arena& other);
+    /**
+     * @brief Creates an arena that keeps this arena's blocks alive as well.
+     *
+     * Used when the nodes of one owner are split between two: each side destroys its
+     * own nodes, and the blocks are freed once both arenas are cleared. This arena keeps
+     * carving slots from its current block and reusing its free slots, which stay valid
+     * because the shared chain outlives both arenas; only the next block it allocates
+     * starts a fresh chain. This arena is unchanged if an exception is thrown.
+     *
+     * @return An arena with no free slots that shares every block of this one.
+     */
+    Node_Arena share();
+    /**
+     * @brief Lets go of every block without running node destructors.
+     *
+     * Blocks still shared with another arena stay allocated until that arena lets go too.
+     */
+    void clear();
+};
+
+#include "Node_Arena.tpp"
+
+#endif // NODE_ARENA_H
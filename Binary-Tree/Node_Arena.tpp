@@ -0,0 +1,186 @@
+/**
+ * @file Node_Arena.tpp
+ * @brief Implementation file for the Node_Arena template class.
+ * @see Node_Arena.h for class documentation.
+ */
+
+#include "Node_Arena.hpp"
+#include <algorithm>
+#include <new>
+#include <utility>
+
+template <class Node>
+Node_Arena<Node>::chain::~chain() {
+    while (newest != nullptr) {
+        slot* previous = newest->next;
+        ::operator delete(newest, std::align_val_t(alignof(slot)));
+        newest = previous;
+    }
+}
+
+template <class Node>
+Node_Arena<Node>::Node_Arena()
+    : cursor(nullptr), limit(nullptr), free_list(nullptr), free_tail(nullptr), next_block(FIRST_BLOCK) {}
+
+template <class Node>
+Node_Arena<Node>::~Node_Arena() {
+    clear();
+}
+
+template <class Node>
+Node_Arena<Node>::Node_Arena(Node_Arena&& other) noexcept : Node_Arena() {
+    swap(other);
+}
+
+template <class Node>
+Node_Arena<Node>& Node_Arena<Node>::operator=(Node_Arena&& other) noexcept {
+    if (this != &other) {
+        clear();
+        swap(other);
+    }
+    return *this;
+}
+
+template <class Node>
+void Node_Arena<Node>::swap(Node_Arena& other) noexcept {
+    std::swap(owned, other.owned);
+    std::swap(shared, other.shared);
+    std::swap(cursor, other.cursor);
+    std::swap(limit, other.limit);
+    std::swap(free_list, other.free_list);
+    std::swap(free_tail, other.free_tail);
+    std::swap(next_block, other.next_block);
+}
+
+template <class Node>
+unsigned long long Node_Arena<Node>::get_block_count() const {
+    unsigned long long count = (owned != nullptr) ? owned->block_count : 0;
+    for (const std::shared_ptr<chain>& held : shared) {
+        count += held->block_count;
+    }
+    return count;
+}
+
+template <class Node>
+void Node_Arena<Node>::allocate_block(const unsigned long long slots) {
+    if (owned == nullptr) {
+        owned = std::make_shared<chain>();
+    }
+    // The first slot of every block links the blocks together
+    const unsigned long long count = slots + 1;
+    slot* block = static_cast<slot*>(::operator new(count * sizeof(slot), std::align_val_t(alignof(slot))));
+    block->next = owned->newest;
+    owned->newest = block;
+    ++owned->block_count;
+    cursor = block + 1;
+    limit = block + count;
+}
+
+template <class Node>
+void Node_Arena<Node>::release(slot* released) {
+    if (free_list == nullptr) {
+        free_tail = released;
+    }
+    released->next = free_list;
+    free_list = released;
+}
+
+template <class Node>
+typename Node_Arena<Node>::slot* Node_Arena<Node>::acquire() {
+    if (free_list != nullptr) {
+        slot* result = free_list;
+        free_list = free_list->next;
+        return result;
+    }
+    if (cursor == limit) {
+        allocate_block(next_block);
+        if (next_block < MAX_BLOCK) {
+            next_block *= 2;
+        }
+    }
+    return cursor++;
+}
+
+template <class Node>
+void Node_Arena<Node>::reserve(const unsigned long long n) {
+    if (static_cast<unsigned long long>(limit - cursor) >= n) {
+        return;
+    }
+    while (cursor != limit) {
+        release(cursor++);
+    }
+    allocate_block(n);
+}
+
+template <class Node>
+template <class... Args>
+Node* Node_Arena<Node>::create(Args&&... args) {
+    slot* target = acquire();
+    try {
+        return ::new (static_cast<void*>(target->storage)) Node(std::forward<Args>(args)...);
+    } catch (...) {
+        release(target);
+        throw;
+    }
+}
+
+template <class Node>
+void Node_Arena<Node>::destroy(Node* node) {
+    node->~Node();
+    release(reinterpret_cast<slot*>(node));
+}
+
+template <class Node>
+void Node_Arena<Node>::absorb(Node_Arena& other) {
+    if (this == &other) {
+        return;
+    }
+    // Reserve first so nothing below can throw
+    shared.reserve(shared.size() + other.shared.size() + 1);
+    if (other.owned != nullptr) {
+        shared.push_back(std::move(other.owned));
+    }
+    for (std::shared_ptr<chain>& held : other.shared) {
+        if (std::find(shared.begin(), shared.end(), held) == shared.end()) {
+            shared.push_back(std::move(held));
+        }
+    }
+    if (other.free_list != nullptr) {
+        other.free_tail->next = free_list;
+        if (free_list == nullptr) {
+            free_tail = other.free_tail;
+        }
+        free_list = other.free_list;
+    }
+    if (cursor == limit) {
+        cursor = other.cursor;
+        limit = other.limit;
+    }
+    other.shared.clear();
+    other.clear();
+}
+
+template <class Node>
+Node_Arena<Node> Node_Arena<Node>::share() {
+    Node_Arena result;
+    result.shared.reserve(shared.size() + 1);
+    shared.reserve(shared.size() + 1);
+    result.shared = shared;
+    if (owned != nullptr) {
+        result.shared.push_back(owned);
+        // The next block this arena allocates starts a chain of its own
+        shared.push_back(std::move(owned));
+    }
+    return result;
+}
+
+template <class Node>
+void Node_Arena<Node>::clear() {
+    owned.reset();
+    shared.clear();
+    cursor = nullptr;
+    limit = nullptr;
+    free_list = nullptr;
+    free_tail = nullptr;
+    next_block = FIRST_BLOCK;
+}
@@ -0,0 +1,180 @@
+/**
+ * @file Tree_Augment.h
+ * @brief Augmentation policies that store extra per-node data in a Binary_Tree.
+ *
+ * A policy provides a Node_Data<T> base for the tree's nodes, compile-time flags
+ * (ENABLED, and ORDER_STATISTICS / AGGREGATES for the queries it supports), and a static
+ * update(node) that recomputes the node's data from its children.
+ * The tree calls update() bottom-up wherever the shape below a node changes: on new
+ * leaves, in rotations, along the retracing path of insertions and deletions, and while
+ * bulk building. Node_Data is an empty base for No_Augment, so an unaugmented tree pays
+ * no memory and no time for the hooks.
+ */
+
+#ifndef TREE_AUGMENT_H
+#define TREE_AUGMENT_H
+
+#include <limits>
+
+/**
+ * @struct No_Augment
+ * @brief The default policy: nodes carry nothing beyond the AVL fields.
+ */
+struct No_Augment {
+    static constexpr bool ENABLED = false;          ///< Ancestors need no update after a change.
+    static constexpr bool ORDER_STATISTICS = false; ///< Nodes do not count their subtrees.
+    static constexpr bool AGGREGATES = false;       ///< Nodes do not aggregate their subtrees.
+
+    /**
+     * @brief Empty node base, removed by the empty base optimization.
+     */
+    template <class T>
+    struct Node_Data {};
+
+    /**
+     * @brief Does nothing.
+     */
+    template <class Node>
+    static void update(Node*) {}
+};
+
+/**
+ * @struct Order_Statistics
+ * @brief Stores the size of every subtree, enabling rank, select and count_range.
+ */
+struct Order_Statistics {
+    static constexpr bool ENABLED = true;          ///< Sizes of all ancestors change with the tree.
+    static constexpr bool ORDER_STATISTICS = true; ///< Nodes count their subtrees.
+    static constexpr bool AGGREGATES = false;      ///< Nodes do not aggregate their subtrees.
+
+    /**
+     * @brief Adds a subtree size to every node.
+     */
+    template <class T>
+    struct Node_Data {
+        unsigned long long size = 1; ///< Number of nodes in the subtree rooted here.
+    };
+
+    /**
+     * @brief Returns the size of a subtree.
+     * @param node Root of the subtree (can be nullptr).
+     * @return Number of nodes in the subtree, 0 for nullptr.
+     */
+    template <class Node>
+    static unsigned long long size_of(const Node* node) {
+        return (node == nullptr) ? 0 : node->size;
+    }
+
+    /**
+     * @brief Recomputes a node's subtree size from its children.
+     * @param node The node to update.
+     */
+    template <class Node>
+    static void update(Node* node) {
+        node->size = 1 + size_of(node->left) + size_of(node->right);
+    }
+};
+
+/**
+ * @struct Monoid_Augment
+ * @brief Stores the aggregate of every subtree under a user-defined monoid, enabling aggregate(lo, hi).
+ *
+ * The aggregate of a subtree combines, in key order, the lifted keys of all its nodes.
+ * combine only has to be associative, not commutative.
+ *
+ * @tparam Monoid Provides value_type, identity(), combine(a, b) and lift(key);
+ *                see Sum_Monoid, Min_Monoid and Max_Monoid.
+ */
+template <class Monoid>
+struct Monoid_Augment {
+    using monoid_type = Monoid;                     ///< The monoid being aggregated.
+    using value_type = typename Monoid::value_type; ///< Type of the aggregate.
+
+    static constexpr bool ENABLED = true;           ///< Aggregates of all ancestors change with the tree.
+    static constexpr bool ORDER_STATISTICS = false; ///< Nodes do not count their subtrees.
+    static constexpr bool AGGREGATES = true;        ///< Nodes aggregate their subtrees.
+
+    /**
+     * @brief Adds a subtree aggregate to every node.
+     */
+    template <class T>
+    struct Node_Data {
+        value_type aggregate = Monoid::identity(); ///< Aggregate of the subtree rooted here.
+    };
+
+    /**
+     * @brief Returns the aggregate of a subtree.
+     * @param node Root of the subtree (can be nullptr).
+     * @return The subtree's aggregate, or the identity for nullptr.
+     */
+    template <class Node>
+    static value_type aggregate_of(const Node* node) {
+        return (node == nullptr) ? Monoid::identity() : node->aggregate;
+    }
+
+    /**
+     * @brief Recomputes a node's aggregate from its children and its own key.
+     * @param node The node to update.
+     */
+    template <class Node>
+    static void update(Node* node) {
+        node->aggregate = Monoid::combine(Monoid::combine(aggregate_of(node->left), Monoid::lift(node->data)),
+                                          aggregate_of(node->right));
+    }
+};
+
+/**
+ * @struct Sum_Monoid
+ * @brief Adds up keys.
+ * @tparam V The accumulator type; keys are converted to it.
+ */
+template <class V>
+struct Sum_Monoid {
+    using value_type = V; ///< Type of the sum.
+
+    /** @brief Returns the sum of no keys. */
+    static V identity() { return V(); }
+    /** @brief Adds two partial sums. */
+    static V combine(const V& a, const V& b) { return a + b; }
+    /** @brief Converts a key to the accumulator type. */
+    template <class T>
+    static V lift(const T& key) { return static_cast<V>(key); }
+};
+
+/**
+ * @struct Min_Monoid
+ * @brief Takes the smallest key.
+ * @tparam V The result type; its largest value is the identity.
+ */
+template <class V>
+struct Min_Monoid {
+    using value_type = V; ///< Type of the minimum.
+
+    /** @brief Returns the minimum of no keys. */
+    static V identity() { return std::numeric_limits<V>::max(); }
+    /** @brief Returns the smaller of two partial minima. */
+    static V combine(const V& a, const V& b) { return (b < a) ? b : a; }
+    /** @brief Converts a key to the result type. */
+    template <class T>
+    static V lift(const T& key) { return static_cast<V>(key); }
+};
+
+/**
+ * @struct Max_Monoid
+ * @brief Takes the largest key.
+ * @tparam V The result type; its lowest value is the identity.
+ */
+template <class V>
+struct Max_Monoid {
+    using value_type = V; ///< Type of the maximum.
+
+    /** @brief Returns the maximum of no keys. */
+    static V identity() { return std::numeric_limits<V>::lowest(); }
+    /** @brief Returns the larger of two partial maxima. */
+    static V combine(const V& a, const V& b) { return (a < b) ? b : a; }
+    /** @brief Converts a key to the result type. */
+    template <class T>
+    static V lift(const T& key) { return static_cast<V>(key); }
+};
+
+#endif // TREE_AUGMENT_H
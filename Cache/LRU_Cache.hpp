@@ -0,0 +1,171 @@
+/**
+ * @file LRU_Cache.h
+ * @brief Declaration of a least-recently-used cache built on a doubly linked recency list.
+ */
+
+#ifndef LRU_CACHE_H
+#define LRU_CACHE_H
+
+#include <functional>
+#include <stdexcept>
+#include "../Linked-List/Doubly_Linked_List.hpp"
+#include "../Hash-Table/List_Index.hpp"
+
+/**
+ * @class LRU_Cache
+ * @brief A generic key-value cache that evicts the least recently used entries.
+ *
+ * Entries are kept in a Doubly_Linked_List ordered from most to least recently used, and a
+ * List_Index maps every key to its list node, so get, put, erase and evict all run in O(1)
+ * expected time. A hit splices the entry to the front without reallocating it.
+ *
+ * Every entry has a charge (1 by default) and the cache evicts from the back while the total
+ * charge exceeds the capacity. Leaving charges at 1 gives a count budget; passing the size
+ * of each value gives a byte budget.
+ *
+ * The cache is not thread-safe; see Sharded_LRU_Cache for concurrent use.
+ *
+ * @tparam Key The key type.
+ * @tparam Value The cached value type.
+ * @tparam Hash Hash function for keys.
+ */
+template <class Key, class Value, class Hash = std::hash<Key>>
+class LRU_Cache {
+private:
+    /**
+     * @struct entry
+     * @brief A cached key-value pair together with its charge.
+     */
+    struct entry {
+        Key key;                   ///< The key.
+        Value value;               ///< The cached value.
+        unsigned long long charge; ///< The entry's share of the capacity.
+    };
+
+    using list_iterator = typename Doubly_Linked_List<entry>::Iterator;
+
+    /**
+     * @struct key_of
+     * @brief Reads the key of the entry a list iterator points to.
+     */
+    struct key_of {
+        const Key& operator()(list_iterator position) const { return position->key; }
+    };
+
+    Doubly_Linked_List<entry> recency; ///< Entries from most to least recently used.
+    List_Index<Key, list_iterator, key_of, Hash> index; ///< Key to list node index.
+    unsigned long long capacity;  ///< Maximum total charge.
+    unsigned long long usage;     ///< Current total charge.
+    unsigned long long hits;      ///< Number of get() calls that found their key.
+    unsigned long long misses;    ///< Number of get() calls that did not.
+    unsigned long long evictions; ///< Number of entries evicted, by trim() or evict().
+
+    /**
+     * @brief Evicts least recently used entries until the usage fits the capacity.
+     */
+    void trim();
+
+public:
+    /**
+     * @brief Constructs an empty cache.
+     * @param capacity Maximum total charge of the cached entries.
+     * @throws std::invalid_argument if capacity is 0.
+     */
+    explicit LRU_Cache(unsigned long long capacity);
+    /**
+     * @brief Copying is disabled: the index refers to the nodes of this cache's list.
+     */
+    LRU_Cache(const LRU_Cache&) = delete;
+    /**
+     * @brief Copy assignment is disabled: the index refers to the nodes of this cache's list.
+     */
+    LRU_Cache& operator=(const LRU_Cache&) = delete;
+    /**
+     * @brief Returns the number of cached entries.
+     * @return The number of entries.
+     */
+    [[nodiscard]] unsigned long long get_size() const;
+    /**
+     * @brief Checks if the cache is empty.
+     * @return True if the cache holds no entries, false otherwise.
+     */
+    [[nodiscard]] bool empty() const;
+    /**
+     * @brief Returns the total charge of the cached entries.
+     * @return The current usage.
+     */
+    [[nodiscard]] unsigned long long get_usage() const;
+    /**
+     * @brief Returns the maximum total charge.
+     * @return The capacity.
+     */
+    [[nodiscard]] unsigned long long get_capacity() const;
+    /**
+     * @brief Changes the capacity, evicting entries if the usage no longer fits.
+     * @param new_capacity The new maximum total charge.
+     * @throws std::invalid_argument if new_capacity is 0.
+     */
+    void set_capacity(unsigned long long new_capacity);
+    /**
+     * @brief Returns the number of lookups that found their key.
+     * @return The hit count.
+     */
+    [[nodiscard]] unsigned long long get_hits() const;
+    /**
+     * @brief Returns the number of lookups that did not find their key.
+     * @return The miss count.
+     */
+    [[nodiscard]] unsigned long long get_misses() const;
+    /**
+     * @brief Returns the number of entries evicted, whether to respect the capacity or by evict().
+     * @return The eviction count.
+     */
+    [[nodiscard]] unsigned long long get_evictions() const;
+    /**
+     * @brief Resets the hit, miss and eviction counters.
+     */
+    void reset_stats();
+    /**
+     * @brief Looks up a key and marks it as most recently used.
+     * @param key The key to look up.
+     * @param value Output: a copy of the cached value on a hit.
+     * @return True on a hit, false on a miss.
+     */
+    bool get(const Key& key, Value& value);
+    /**
+     * @brief Checks whether a key is cached without touching its recency or the counters.
+     * @param key The key to look up.
+     * @return True if the key is cached, false otherwise.
+     */
+    [[nodiscard]] bool contains(const Key& key) const;
+    /**
+     * @brief Inserts or replaces an entry, marks it most recently used and evicts as needed.
+     *
+     * An entry whose charge alone exceeds the capacity is not cached, and any older entry
+     * for the key is removed.
+     *
+     * @param key The key.
+     * @param value The value to cache.
+     * @param charge The entry's share of the capacity.
+     */
+    void put(const Key& key, Value value, unsigned long long charge = 1);
+    /**
+     * @brief Removes an entry.
+     * @param key The key to remove.
+     * @return True if the key was cached, false otherwise.
+     */
+    bool erase(const Key& key);
+    /**
+     * @brief Evicts the least recently used entry.
+     * @return True if an entry was evicted, false if the cache was empty.
+     */
+    bool evict();
+    /**
+     * @brief Removes every entry. The counters are kept.
+     */
+    void clear();
+};
+
+#include "LRU_Cache.tpp"
+
+#endif // LRU_CACHE_H
@@ -0,0 +1,146 @@
+/**
+ * @file LRU_Cache.tpp
+ * @brief Implementation file for the LRU_Cache template class.
+ * @see LRU_Cache.h for class documentation.
+ */
+
+#include "LRU_Cache.hpp"
+#include <utility>
+
+template <class Key, class Value, class Hash>
+LRU_Cache<Key, Value, Hash>::LRU_Cache(const unsigned long long capacity)
+    : capacity(capacity), usage(0), hits(0), misses(0), evictions(0) {
+    if (capacity == 0) {
+        throw std::invalid_argument("Cache capacity must be positive");
+    }
+}
+
+template <class Key, class Value, class Hash>
+unsigned long long LRU_Cache<Key, Value, Hash>::get_size() const {
+    return recency.get_length();
+}
+
+template <class Key, class Value, class Hash>
+bool LRU_Cache<Key, Value, Hash>::empty() const {
+    return recency.empty();
+}
+
+template <class Key, class Value, class Hash>
+unsigned long long LRU_Cache<Key, Value, Hash>::get_usage() const {
+    return usage;
+}
+
+template <class Key, class Value, class Hash>
+unsigned long long LRU_Cache<Key, Value, Hash>::get_capacity() const {
+    return capacity;
+}
+
+template <class Key, class Value, class Hash>
+void LRU_Cache<Key, Value, Hash>::set_capacity(const unsigned long long new_capacity) {
+    if (new_capacity == 0) {
+        throw std::invalid_argument("Cache capacity must be positive");
+    }
+    capacity = new_capacity;
+    trim();
+}
+
+template <class Key, class Value, class Hash>
+unsigned long long LRU_Cache<Key, Value, Hash>::get_hits() const {
+    return hits;
+}
+
+template <class Key, class Value, class Hash>
+unsigned long long LRU_Cache<Key, Value, Hash>::get_misses() const {
+    return misses;
+}
+
+template <class Key, class Value, class Hash>
+unsigned long long LRU_Cache<Key, Value, Hash>::get_evictions() const {
+    return evictions;
+}
+
+template <class Key, class Value, class Hash>
+void LRU_Cache<Key, Value, Hash>::reset_stats() {
+    hits = misses = evictions = 0;
+}
+
+template <class Key, class Value, class Hash>
+void LRU_Cache<Key, Value, Hash>::trim() {
+    // A nonzero usage means the list is not empty, so evict() always removes an entry here
+    while (usage > capacity) {
+        evict();
+    }
+}
+
+template <class Key, class Value, class Hash>
+bool LRU_Cache<Key, Value, Hash>::get(const Key& key, Value& value) {
+    list_iterator position;
+    if (!index.find(key, position)) {
+        ++misses;
+        return false;
+    }
+    ++hits;
+    recency.splice(recency.begin(), recency, position);
+    value = position->value;
+    return true;
+}
+
+template <class Key, class Value, class Hash>
+bool LRU_Cache<Key, Value, Hash>::contains(const Key& key) const {
+    list_iterator position;
+    return index.find(key, position);
+}
+
+template <class Key, class Value, class Hash>
+void LRU_Cache<Key, Value, Hash>::put(const Key& key, Value value, const unsigned long long charge) {
+    if (charge > capacity) {
+        // Caching it would flush every other entry and then the entry itself
+        erase(key);
+        return;
+    }
+    list_iterator position;
+    if (index.find(key, position)) {
+        usage = usage - position->charge + charge;
+        position->value = std::move(value);
+        position->charge = charge;
+        recency.splice(recency.begin(), recency, position);
+    } else {
+        recency.push_front(entry{key, std::move(value), charge});
+        index.insert(recency.begin());
+        usage += charge;
+    }
+    trim();
+}
+
+template <class Key, class Value, class Hash>
+bool LRU_Cache<Key, Value, Hash>::erase(const Key& key) {
+    list_iterator position;
+    if (!index.find(key, position)) {
+        return false;
+    }
+    index.erase(key);
+    usage -= position->charge;
+    recency.erase(position);
+    return true;
+}
+
+template <class Key, class Value, class Hash>
+bool LRU_Cache<Key, Value, Hash>::evict() {
+    if (recency.empty()) {
+        return false;
+    }
+    list_iterator victim = recency.end();
+    --victim;
+    index.erase(victim->key);
+    usage -= victim->charge;
+    recency.erase(victim);
+    ++evictions;
+    return true;
+}
+
+template <class Key, class Value, class Hash>
+void LRU_Cache<Key, Value, Hash>::clear() {
+    index.clear();
+    recency.clear();
+    usage = 0;
+}
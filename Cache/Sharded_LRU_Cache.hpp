@@ -0,0 +1,135 @@
+/**
+ * @file Sharded_LRU_Cache.h
+ * @brief Declaration of a thread-safe LRU cache split into independently locked shards.
+ */
+
+#ifndef SHARDED_LRU_CACHE_H
+#define SHARDED_LRU_CACHE_H
+
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include "LRU_Cache.hpp"
+
+/**
+ * @class Sharded_LRU_Cache
+ * @brief A generic key-value cache safe for concurrent use from several threads.
+ *
+ * Keys are distributed over a fixed number of LRU_Cache shards by hash, and each shard has
+ * its own mutex, so threads touching different shards never contend. The capacity is split
+ * evenly between the shards and recency is tracked per shard, which makes eviction an
+ * approximation of global LRU order.
+ *
+ * @tparam Key The key type.
+ * @tparam Value The cached value type.
+ * @tparam Hash Hash function for keys.
+ */
+template <class Key, class Value, class Hash = std::hash<Key>>
+class Sharded_LRU_Cache {
+private:
+    /**
+     * @struct shard
+     * @brief One independently locked part of the cache.
+     */
+    struct shard {
+        std::mutex lock;                   ///< Guards the shard's cache.
+        LRU_Cache<Key, Value, Hash> cache; ///< The shard's entries.
+
+        /**
+         * @brief Constructs a shard with its share of the capacity.
+         * @param capacity The shard's capacity.
+         */
+        explicit shard(unsigned long long capacity) : cache(capacity) {}
+    };
+
+    shard** shards;          ///< Array of shard pointers.
+    std::size_t shard_count; ///< Number of shards.
+    Hash hasher;             ///< Hash function used to pick shards.
+
+    /**
+     * @brief Returns the shard responsible for a key.
+     * @param key The key.
+     * @return Reference to the shard.
+     */
+    shard& shard_of(const Key& key) const;
+
+public:
+    /**
+     * @brief Constructs an empty cache.
+     * @param capacity Maximum total charge, split evenly between the shards.
+     * @param shard_count Number of shards.
+     * @throws std::invalid_argument if shard_count is 0 or capacity is smaller than shard_count.
+     */
+    explicit Sharded_LRU_Cache(unsigned long long capacity, std::size_t shard_count = 16);
+    /**
+     * @brief Destructor. Frees every shard.
+     */
+    ~Sharded_LRU_Cache();
+    /**
+     * @brief Copying is disabled.
+     */
+    Sharded_LRU_Cache(const Sharded_LRU_Cache&) = delete;
+    /**
+     * @brief Copy assignment is disabled.
+     */
+    Sharded_LRU_Cache& operator=(const Sharded_LRU_Cache&) = delete;
+    /**
+     * @brief Returns the number of shards.
+     * @return The shard count.
+     */
+    [[nodiscard]] std::size_t get_shard_count() const;
+    /**
+     * @brief Returns the number of cached entries across all shards.
+     * @return The number of entries.
+     */
+    [[nodiscard]] unsigned long long get_size() const;
+    /**
+     * @brief Returns the total charge of the cached entries across all shards.
+     * @return The current usage.
+     */
+    [[nodiscard]] unsigned long long get_usage() const;
+    /**
+     * @brief Returns the number of lookups that found their key, across all shards.
+     * @return The hit count.
+     */
+    [[nodiscard]] unsigned long long get_hits() const;
+    /**
+     * @brief Returns the number of lookups that did not find their key, across all shards.
+     * @return The miss count.
+     */
+    [[nodiscard]] unsigned long long get_misses() const;
+    /**
+     * @brief Returns the number of evicted entries across all shards.
+     * @return The eviction count.
+     */
+    [[nodiscard]] unsigned long long get_evictions() const;
+    /**
+     * @brief Looks up a key and marks it as most recently used in its shard.
+     * @param key The key to look up.
+     * @param value Output: a copy of the cached value on a hit.
+     * @return True on a hit, false on a miss.
+     */
+    bool get(const Key& key, Value& value);
+    /**
+     * @brief Inserts or replaces an entry and evicts from its shard as needed.
+     * @param key The key.
+     * @param value The value to cache.
+     * @param charge The entry's share of the capacity.
+     */
+    void put(const Key& key, Value value, unsigned long long charge = 1);
+    /**
+     * @brief Removes an entry.
+     * @param key The key to remove.
+     * @return True if the key was cached, false otherwise.
+     */
+    bool erase(const Key& key);
+    /**
+     * @brief Removes every entry from every shard.
+     */
+    void clear();
+};
+
+#include "Sharded_LRU_Cache.tpp"
+
+#endif // SHARDED_LRU_CACHE_H
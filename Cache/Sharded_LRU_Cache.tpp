@@ -0,0 +1,128 @@
+/**
+ * @file Sharded_LRU_Cache.tpp
+ * @brief Implementation file for the Sharded_LRU_Cache template class.
+ * @see Sharded_LRU_Cache.h for class documentation.
+ */
+
+#include "Sharded_LRU_Cache.hpp"
+#include <utility>
+
+template <class Key, class Value, class Hash>
+Sharded_LRU_Cache<Key, Value, Hash>::Sharded_LRU_Cache(const unsigned long long capacity, const std::size_t shard_count)
+    : shards(nullptr), shard_count(shard_count) {
+    if (shard_count == 0 || capacity < shard_count) {
+        throw std::invalid_argument("Sharded cache needs at least one unit of capacity per shard");
+    }
+    shards = new shard*[shard_count];
+    std::size_t built = 0;
+    try {
+        for (; built < shard_count; ++built) {
+            // Spread the remainder so the shard capacities add up to the total
+            shards[built] = new shard(capacity / shard_count + (built < capacity % shard_count ? 1 : 0));
+        }
+    } catch (...) {
+        // The destructor will not run, so free the shards built so far before rethrowing
+        for (std::size_t i = 0; i < built; ++i) {
+            delete shards[i];
+        }
+        delete[] shards;
+        throw;
+    }
+}
+
+template <class Key, class Value, class Hash>
+Sharded_LRU_Cache<Key, Value, Hash>::~Sharded_LRU_Cache() {
+    for (std::size_t i = 0; i < shard_count; ++i) {
+        delete shards[i];
+    }
+    delete[] shards;
+}
+
+template <class Key, class Value, class Hash>
+typename Sharded_LRU_Cache<Key, Value, Hash>::shard& Sharded_LRU_Cache<Key, Value, Hash>::shard_of(const Key& key) const {
+    return *shards[hasher(key) % shard_count];
+}
+
+template <class Key, class Value, class Hash>
+std::size_t Sharded_LRU_Cache<Key, Value, Hash>::get_shard_count() const {
+    return shard_count;
+}
+
+template <class Key, class Value, class Hash>
+unsigned long long Sharded_LRU_Cache<Key, Value, Hash>::get_size() const {
+    unsigned long long total = 0;
+    for (std::size_t i = 0; i < shard_count; ++i) {
+        std::lock_guard<std::mutex> guard(shards[i]->lock);
+        total += shards[i]->cache.get_size();
+    }
+    return total;
+}
+
+template <class Key, class Value, class Hash>
+unsigned long long Sharded_LRU_Cache<Key, Value, Hash>::get_usage() const {
+    unsigned long long total = 0;
+    for (std::size_t i = 0; i < shard_count; ++i) {
+        std::lock_guard<std::mutex> guard(shards[i]->lock);
+        total += shards[i]->cache.get_usage();
+    }
+    return total;
+}
+
+template <class Key, class Value, class Hash>
+unsigned long long Sharded_LRU_Cache<Key, Value, Hash>::get_hits() const {
+    unsigned long long total = 0;
+    for (std::size_t i = 0; i < shard_count; ++i) {
+        std::lock_guard<std::mutex> guard(shards[i]->lock);
+        total += shards[i]->cache.get_hits();
+    }
+    return total;
+}
+
+template <class Key, class Value, class Hash>
+unsigned long long Sharded_LRU_Cache<Key, Value, Hash>::get_misses() const {
+    unsigned long long total = 0;
+    for (std::size_t i = 0; i < shard_count; ++i) {
+        std::lock_guard<std::mutex> guard(shards[i]->lock);
+        total += shards[i]->cache.get_misses();
+    }
+    return total;
+}
+
+template <class Key, class Value, class Hash>
+unsigned long long Sharded_LRU_Cache<Key, Value, Hash>::get_evictions() const {
+    unsigned long long total = 0;
+    for (std::size_t i = 0; i < shard_count; ++i) {
+        std::lock_guard<std::mutex> guard(shards[i]->lock);
+        total += shards[i]->cache.get_evictions();
+    }
+    return total;
+}
+
+template <class Key, class Value, class Hash>
+bool Sharded_LRU_Cache<Key, Value, Hash>::get(const Key& key, Value& value) {
+    shard& owner = shard_of(key);
+    std::lock_guard<std::mutex> guard(owner.lock);
+    return owner.cache.get(key, value);
+}
+
+template <class Key, class Value, class Hash>
+void Sharded_LRU_Cache<Key, Value, Hash>::put(const Key& key, Value value, const unsigned long long charge) {
+    shard& owner = shard_of(key);
+    std::lock_guard<std::mutex> guard(owner.lock);
+    owner.cache.put(key, std::move(value), charge);
+}
+
+template <class Key, class Value, class Hash>
+bool Sharded_LRU_Cache<Key, Value, Hash>::erase(const Key& key) {
+    shard& owner = shard_of(key);
+    std::lock_guard<std::mutex> guard(owner.lock);
+    return owner.cache.erase(key);
+}
+
+template <class Key, class Value, class Hash>
+void Sharded_LRU_Cache<Key, Value, Hash>::clear() {
+    for (std::size_t i = 0; i < shard_count; ++i) {
+        std::lock_guard<std::mutex> guard(shards[i]->lock);
+        shards[i]->cache.clear();
+    }
+}
@@ -0,0 +1,163 @@
+/**
+ * @file Linked_Hash_Map.h
+ * @brief Declaration of a hash map that iterates in insertion order.
+ */
+
+#ifndef LINKED_HASH_MAP_H
+#define LINKED_HASH_MAP_H
+
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+#include "../Linked-List/Doubly_Linked_List.hpp"
+#include "List_Index.hpp"
+
+/**
+ * @class Linked_Hash_Map
+ * @brief A generic key-value map with O(1) expected lookups that remembers insertion order.
+ *
+ * Key-value pairs are threaded through a Doubly_Linked_List in the order their keys were
+ * first inserted, and a List_Index maps every key to its list node, so lookups, insertions
+ * and erasures run in O(1) expected time while iteration follows insertion order. Assigning
+ * a new value to an existing key keeps the key's original position.
+ *
+ * @tparam Key The key type. Must be hashable and equality comparable.
+ * @tparam Value The mapped type.
+ * @tparam Hash Hash function for keys.
+ */
+template <class Key, class Value, class Hash = std::hash<Key>>
+class Linked_Hash_Map {
+public:
+    /**
+     * @brief Bidirectional iterator over the key-value pairs in insertion order (keys are read-only).
+     */
+    using Iterator = typename Doubly_Linked_List<std::pair<const Key, Value>>::Iterator;
+
+private:
+    /**
+     * @struct key_of
+     * @brief Reads the key of the pair an order-list iterator points to.
+     */
+    struct key_of {
+        const Key& operator()(Iterator position) const { return position->first; }
+    };
+
+    Doubly_Linked_List<std::pair<const Key, Value>> order; ///< Key-value pairs in insertion order.
+    List_Index<Key, Iterator, key_of, Hash> index; ///< Key to list node index.
+
+    /**
+     * @brief Indexes every node of the order list into an empty index.
+     */
+    void reindex();
+
+public:
+    /**
+     * @brief Default constructor. Initializes an empty map.
+     */
+    Linked_Hash_Map();
+    /**
+     * @brief Constructs a map from an initializer list; later duplicates of a key are ignored.
+     * @param array The initializer list of key-value pairs.
+     */
+    Linked_Hash_Map(std::initializer_list<std::pair<const Key, Value>> array);
+    /**
+     * @brief Copy constructor. Preserves the insertion order.
+     * @param other The map to copy from.
+     */
+    Linked_Hash_Map(const Linked_Hash_Map& other);
+    /**
+     * @brief Copy assignment operator. Preserves the insertion order.
+     * @param other The map to copy from.
+     * @return Reference to this map.
+     */
+    Linked_Hash_Map& operator=(const Linked_Hash_Map& other);
+    /**
+     * @brief Returns the number of key-value pairs in the map.
+     * @return The number of pairs.
+     */
+    [[nodiscard]] unsigned long long get_length() const;
+    /**
+     * @brief Checks if the map is empty.
+     * @return True if the map is empty, false otherwise.
+     */
+    [[nodiscard]] bool empty() const;
+    /**
+     * @brief Makes room for at least n keys without rehashing.
+     * @param n The number of keys to make room for.
+     */
+    void reserve(unsigned long long n);
+    /**
+     * @brief Checks whether a key is in the map.
+     * @param key The key to look up.
+     * @return True if present, false otherwise.
+     */
+    [[nodiscard]] bool contains(const Key& key) const;
+    /**
+     * @brief Finds a key.
+     * @param key The key to look up.
+     * @return Iterator to the key's pair, or end() if it is not present.
+     */
+    Iterator find(const Key& key);
+    /**
+     * @brief Appends a key-value pair if the key is not already present.
+     * @param key The key.
+     * @param value The value.
+     * @return True if the pair was inserted, false if the key was already present (its value is kept).
+     */
+    bool insert(const Key& key, Value value);
+    /**
+     * @brief Accesses the value of a key, appending a default-constructed value if it is absent.
+     * @param key The key.
+     * @return Reference to the value.
+     */
+    Value& operator[](const Key& key);
+    /**
+     * @brief Accesses the value of a key that must be present.
+     * @param key The key.
+     * @return Reference to the value.
+     * @throws std::out_of_range if the key is not present.
+     */
+    Value& at(const Key& key);
+    /**
+     * @brief Removes a key and its value.
+     * @param key The key to remove.
+     * @return True if the key was removed, false if it was not present.
+     */
+    bool erase(const Key& key);
+    /**
+     * @brief Removes the pair an iterator points to.
+     * @param pos Iterator to the pair to remove. Must not be end().
+     * @return Iterator to the pair that followed the removed one.
+     * @throws std::runtime_error if pos is end().
+     */
+    Iterator erase(Iterator pos);
+    /**
+     * @brief Returns the oldest key-value pair.
+     * @return Reference to the first inserted pair still present.
+     * @throws std::out_of_range if the map is empty.
+     */
+    std::pair<const Key, Value>& front_item();
+    /**
+     * @brief Removes the oldest key-value pair.
+     */
+    void pop_front();
+    /**
+     * @brief Removes all key-value pairs from the map.
+     */
+    void clear();
+    /**
+     * @brief Returns an iterator to the oldest key-value pair.
+     * @return Iterator to the first pair.
+     */
+    Iterator begin();
+    /**
+     * @brief Returns an iterator past the newest key-value pair.
+     * @return Iterator to one past the last pair.
+     */
+    Iterator end();
+};
+
+#include "Linked_Hash_Map.tpp"
+
+#endif // LINKED_HASH_MAP_H
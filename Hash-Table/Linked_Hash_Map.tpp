@@ -0,0 +1,149 @@
+/**
+ * @file Linked_Hash_Map.tpp
+ * @brief Implementation file for the Linked_Hash_Map template class.
+ * @see Linked_Hash_Map.h for class documentation.
+ */
+
+#include "Linked_Hash_Map.hpp"
+
+template <class Key, class Value, class Hash>
+Linked_Hash_Map<Key, Value, Hash>::Linked_Hash_Map() = default;
+
+template <class Key, class Value, class Hash>
+Linked_Hash_Map<Key, Value, Hash>::Linked_Hash_Map(std::initializer_list<std::pair<const Key, Value>> array) {
+    index.reserve(array.size());
+    for (const std::pair<const Key, Value>& item : array) {
+        insert(item.first, item.second);
+    }
+}
+
+template <class Key, class Value, class Hash>
+Linked_Hash_Map<Key, Value, Hash>::Linked_Hash_Map(const Linked_Hash_Map& other) : order(other.order) {
+    reindex();
+}
+
+template <class Key, class Value, class Hash>
+Linked_Hash_Map<Key, Value, Hash>& Linked_Hash_Map<Key, Value, Hash>::operator=(const Linked_Hash_Map& other) {
+    if (this != &other) {
+        index.clear();
+        order = other.order;
+        reindex();
+    }
+    return *this;
+}
+
+template <class Key, class Value, class Hash>
+void Linked_Hash_Map<Key, Value, Hash>::reindex() {
+    index.reserve(order.get_length());
+    for (Iterator it = order.begin(); it != order.end(); ++it) {
+        index.insert(it);
+    }
+}
+
+template <class Key, class Value, class Hash>
+unsigned long long Linked_Hash_Map<Key, Value, Hash>::get_length() const {
+    return order.get_length();
+}
+
+template <class Key, class Value, class Hash>
+bool Linked_Hash_Map<Key, Value, Hash>::empty() const {
+    return order.empty();
+}
+
+template <class Key, class Value, class Hash>
+void Linked_Hash_Map<Key, Value, Hash>::reserve(const unsigned long long n) {
+    index.reserve(n);
+}
+
+template <class Key, class Value, class Hash>
+bool Linked_Hash_Map<Key, Value, Hash>::contains(const Key& key) const {
+    Iterator position;
+    return index.find(key, position);
+}
+
+template <class Key, class Value, class Hash>
+typename Linked_Hash_Map<Key, Value, Hash>::Iterator Linked_Hash_Map<Key, Value, Hash>::find(const Key& key) {
+    Iterator position;
+    return index.find(key, position) ? position : end();
+}
+
+template <class Key, class Value, class Hash>
+bool Linked_Hash_Map<Key, Value, Hash>::insert(const Key& key, Value value) {
+    Iterator position;
+    if (index.find(key, position)) {
+        return false;
+    }
+    order.push_back(std::pair<const Key, Value>(key, std::move(value)));
+    index.insert(--order.end());
+    return true;
+}
+
+template <class Key, class Value, class Hash>
+Value& Linked_Hash_Map<Key, Value, Hash>::operator[](const Key& key) {
+    Iterator position;
+    if (!index.find(key, position)) {
+        order.push_back(std::pair<const Key, Value>(key, Value()));
+        position = --order.end();
+        index.insert(position);
+    }
+    return position->second;
+}
+
+template <class Key, class Value, class Hash>
+Value& Linked_Hash_Map<Key, Value, Hash>::at(const Key& key) {
+    Iterator position;
+    if (!index.find(key, position)) {
+        throw std::out_of_range("Key not found in at()");
+    }
+    return position->second;
+}
+
+template <class Key, class Value, class Hash>
+bool Linked_Hash_Map<Key, Value, Hash>::erase(const Key& key) {
+    Iterator position;
+    if (!index.find(key, position)) {
+        return false;
+    }
+    index.erase(key);
+    order.erase(position);
+    return true;
+}
+
+template <class Key, class Value, class Hash>
+typename Linked_Hash_Map<Key, Value, Hash>::Iterator Linked_Hash_Map<Key, Value, Hash>::erase(Iterator pos) {
+    if (pos == end()) {
+        throw std::runtime_error("Cannot erase end() iterator");
+    }
+    index.erase(pos->first);
+    return order.erase(pos);
+}
+
+template <class Key, class Value, class Hash>
+std::pair<const Key, Value>& Linked_Hash_Map<Key, Value, Hash>::front_item() {
+    if (empty()) {
+        throw std::out_of_range("Map is empty in front_item()");
+    }
+    return *order.begin();
+}
+
+template <class Key, class Value, class Hash>
+void Linked_Hash_Map<Key, Value, Hash>::pop_front() {
+    if (empty()) return;
+    erase(order.begin());
+}
+
+template <class Key, class Value, class Hash>
+void Linked_Hash_Map<Key, Value, Hash>::clear() {
+    index.clear();
+    order.clear();
+}
+
+template <class Key, class Value, class Hash>
+typename Linked_Hash_Map<Key, Value, Hash>::Iterator Linked_Hash_Map<Key, Value, Hash>::begin() {
+    return order.begin();
+}
+
+template <class Key, class Value, class Hash>
+typename Linked_Hash_Map<Key, Value, Hash>::Iterator Linked_Hash_Map<Key, Value, Hash>::end() {
+    return order.end();
+}
@@ -0,0 +1,151 @@
+/**
+ * @file Linked_Hash_Set.h
+ * @brief Declaration of a hash set that iterates in insertion order.
+ */
+
+#ifndef LINKED_HASH_SET_H
+#define LINKED_HASH_SET_H
+
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include "../Linked-List/Doubly_Linked_List.hpp"
+#include "List_Index.hpp"
+
+/**
+ * @class Linked_Hash_Set
+ * @brief A generic set with O(1) expected membership tests that remembers insertion order.
+ *
+ * Elements are threaded through a Doubly_Linked_List in the order they were first inserted,
+ * and a List_Index maps every element to its list node, so contains, insert and erase run
+ * in O(1) expected time while iteration follows insertion order. Re-inserting an element
+ * that is already present keeps its original position.
+ *
+ * @tparam T The element type. Must be hashable and equality comparable.
+ * @tparam Hash Hash function for elements.
+ */
+template <class T, class Hash = std::hash<T>>
+class Linked_Hash_Set {
+public:
+    /**
+     * @brief Bidirectional iterator over the elements in insertion order (elements are read-only).
+     */
+    using Iterator = typename Doubly_Linked_List<const T>::Iterator;
+
+private:
+    /**
+     * @struct key_of
+     * @brief Reads the element an order-list iterator points to.
+     */
+    struct key_of {
+        const T& operator()(Iterator position) const { return *position; }
+    };
+
+    Doubly_Linked_List<const T> order; ///< Elements in insertion order.
+    List_Index<T, Iterator, key_of, Hash> index; ///< Element to list node index.
+
+    /**
+     * @brief Indexes every node of the order list into an empty index.
+     */
+    void reindex();
+
+public:
+    /**
+     * @brief Default constructor. Initializes an empty set.
+     */
+    Linked_Hash_Set();
+    /**
+     * @brief Constructs a set from an initializer list, skipping duplicates.
+     * @param array The initializer list of elements.
+     */
+    Linked_Hash_Set(std::initializer_list<T> array);
+    /**
+     * @brief Copy constructor. Preserves the insertion order.
+     * @param other The set to copy from.
+     */
+    Linked_Hash_Set(const Linked_Hash_Set& other);
+    /**
+     * @brief Copy assignment operator. Preserves the insertion order.
+     * @param other The set to copy from.
+     * @return Reference to this set.
+     */
+    Linked_Hash_Set& operator=(const Linked_Hash_Set& other);
+    /**
+     * @brief Returns the number of elements in the set.
+     * @return The number of elements.
+     */
+    [[nodiscard]] unsigned long long get_length() const;
+    /**
+     * @brief Checks if the set is empty.
+     * @return True if the set is empty, false otherwise.
+     */
+    [[nodiscard]] bool empty() const;
+    /**
+     * @brief Makes room for at least n elements without rehashing.
+     * @param n The number of elements to make room for.
+     */
+    void reserve(unsigned long long n);
+    /**
+     * @brief Checks whether an element is in the set.
+     * @param value The element to look up.
+     * @return True if present, false otherwise.
+     */
+    [[nodiscard]] bool contains(const T& value) const;
+    /**
+     * @brief Finds an element.
+     * @param value The element to look up.
+     * @return Iterator to the element, or end() if it is not present.
+     */
+    Iterator find(const T& value);
+    /**
+     * @brief Appends an element if it is not already present.
+     * @param value The element to insert.
+     * @return True if the element was inserted, false if it was already present.
+     */
+    bool insert(const T& value);
+    /**
+     * @brief Removes an element.
+     * @param value The element to remove.
+     * @return True if the element was removed, false if it was not present.
+     */
+    bool erase(const T& value);
+    /**
+     * @brief Removes the element an iterator points to.
+     * @param pos Iterator to the element to remove. Must not be end().
+     * @return Iterator to the element that followed the removed one.
+     * @throws std::runtime_error if pos is end().
+     */
+    Iterator erase(Iterator pos);
+    /**
+     * @brief Returns the oldest element.
+     * @return Reference to the first inserted element still present.
+     * @throws std::out_of_range if the set is empty.
+     */
+    const T& front_item();
+    /**
+     * @brief Removes the oldest element.
+     */
+    void pop_front();
+    /**
+     * @brief Removes all elements from the set.
+     */
+    void clear();
+    /**
+     * @brief Prints the elements in insertion order to standard output.
+     */
+    void print() const;
+    /**
+     * @brief Returns an iterator to the oldest element.
+     * @return Iterator to the first element.
+     */
+    Iterator begin();
+    /**
+     * @brief Returns an iterator past the newest element.
+     * @return Iterator to one past the last element.
+     */
+    Iterator end();
+};
+
+#include "Linked_Hash_Set.tpp"
+
+#endif // LINKED_HASH_SET_H
@@ -0,0 +1,134 @@
+/**
+ * @file Linked_Hash_Set.tpp
+ * @brief Implementation file for the Linked_Hash_Set template class.
+ * @see Linked_Hash_Set.h for class documentation.
+ */
+
+#include "Linked_Hash_Set.hpp"
+
+template <class T, class Hash>
+Linked_Hash_Set<T, Hash>::Linked_Hash_Set() = default;
+
+template <class T, class Hash>
+Linked_Hash_Set<T, Hash>::Linked_Hash_Set(std::initializer_list<T> array) {
+    index.reserve(array.size());
+    for (const T& item : array) {
+        insert(item);
+    }
+}
+
+template <class T, class Hash>
+Linked_Hash_Set<T, Hash>::Linked_Hash_Set(const Linked_Hash_Set& other) : order(other.order) {
+    reindex();
+}
+
+template <class T, class Hash>
+Linked_Hash_Set<T, Hash>& Linked_Hash_Set<T, Hash>::operator=(const Linked_Hash_Set& other) {
+    if (this != &other) {
+        index.clear();
+        order = other.order;
+        reindex();
+    }
+    return *this;
+}
+
+template <class T, class Hash>
+void Linked_Hash_Set<T, Hash>::reindex() {
+    index.reserve(order.get_length());
+    for (Iterator it = order.begin(); it != order.end(); ++it) {
+        index.insert(it);
+    }
+}
+
+template <class T, class Hash>
+unsigned long long Linked_Hash_Set<T, Hash>::get_length() const {
+    return order.get_length();
+}
+
+template <class T, class Hash>
+bool Linked_Hash_Set<T, Hash>::empty() const {
+    return order.empty();
+}
+
+template <class T, class Hash>
+void Linked_Hash_Set<T, Hash>::reserve(const unsigned long long n) {
+    index.reserve(n);
+}
+
+template <class T, class Hash>
+bool Linked_Hash_Set<T, Hash>::contains(const T& value) const {
+    Iterator position;
+    return index.find(value, position);
+}
+
+template <class T, class Hash>
+typename Linked_Hash_Set<T, Hash>::Iterator Linked_Hash_Set<T, Hash>::find(const T& value) {
+    Iterator position;
+    return index.find(value, position) ? position : end();
+}
+
+template <class T, class Hash>
+bool Linked_Hash_Set<T, Hash>::insert(const T& value) {
+    Iterator position;
+    if (index.find(value, position)) {
+        return false;
+    }
+    order.push_back(value);
+    index.insert(--order.end());
+    return true;
+}
+
+template <class T, class Hash>
+bool Linked_Hash_Set<T, Hash>::erase(const T& value) {
+    Iterator position;
+    if (!index.find(value, position)) {
+        return false;
+    }
+    index.erase(value);
+    order.erase(position);
+    return true;
+}
+
+template <class T, class Hash>
+typename Linked_Hash_Set<T, Hash>::Iterator Linked_Hash_Set<T, Hash>::erase(Iterator pos) {
+    if (pos == end()) {
+        throw std::runtime_error("Cannot erase end() iterator");
+    }
+    index.erase(*pos);
+    return order.erase(pos);
+}
+
+template <class T, class Hash>
+const T& Linked_Hash_Set<T, Hash>::front_item() {
+    if (empty()) {
+        throw std::out_of_range("Set is empty in front_item()");
+    }
+    return *order.begin();
+}
+
+template <class T, class Hash>
+void Linked_Hash_Set<T, Hash>::pop_front() {
+    if (empty()) return;
+    erase(order.begin());
+}
+
+template <class T, class Hash>
+void Linked_Hash_Set<T, Hash>::clear() {
+    index.clear();
+    order.clear();
+}
+
+template <class T, class Hash>
+void Linked_Hash_Set<T, Hash>::print() const {
+    order.print();
+}
+
+template <class T, class Hash>
+typename Linked_Hash_Set<T, Hash>::Iterator Linked_Hash_Set<T, Hash>::begin() {
+    return order.begin();
+}
+
+template <class T, class Hash>
+typename Linked_Hash_Set<T, Hash>::Iterator Linked_Hash_Set<T, Hash>::end() {
+    return order.end();
+}
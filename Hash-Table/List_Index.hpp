@@ -0,0 +1,138 @@
+/**
+ * @file List_Index.h
+ * @brief Declaration of an open-addressing hash index over the nodes of a linked list.
+ */
+
+#ifndef LIST_INDEX_H
+#define LIST_INDEX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+/**
+ * @class List_Index
+ * @brief An open-addressing hash table mapping keys to iterators of a linked list.
+ *
+ * The keys themselves live in the list nodes; each slot only stores the cached hash and
+ * the iterator, and keys are read back through KeyOf when probing. Collisions are resolved
+ * by linear probing over a power-of-two table kept at most 3/4 full, and erasure shifts the
+ * following entries back so no tombstones are left behind.
+ *
+ * The index does not own the list. Iterators stored in it must stay valid, which holds for
+ * node-based lists as long as the node is not erased (splicing a node keeps its iterator).
+ *
+ * @tparam Key The key type.
+ * @tparam Iterator The list iterator type. Must be default constructible and copyable.
+ * @tparam KeyOf Callable returning the key (const Key&) of the element an Iterator points to.
+ * @tparam Hash Hash function for keys.
+ * @tparam KeyEqual Equality predicate for keys.
+ */
+template <class Key, class Iterator, class KeyOf, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>>
+class List_Index {
+private:
+    /**
+     * @struct slot
+     * @brief A table entry; a hash of 0 marks an empty slot.
+     */
+    struct slot {
+        std::size_t hash;  ///< Mixed hash of the key (never 0 when occupied).
+        Iterator position; ///< Iterator to the list node holding the key.
+    };
+
+    slot* slots;          ///< The table, or nullptr before the first insertion.
+    std::size_t capacity; ///< Number of slots (0 or a power of two).
+    std::size_t count;    ///< Number of occupied slots.
+    Hash hasher;          ///< Hash function.
+    KeyEqual equal;       ///< Key equality predicate.
+    KeyOf key_of;         ///< Key extractor.
+
+    /**
+     * @brief Hashes and mixes a key so that every bit of the hash influences the home slot.
+     * @param key The key to hash.
+     * @return A non-zero mixed hash.
+     */
+    std::size_t hash_of(const Key& key) const;
+    /**
+     * @brief Returns the home slot of a mixed hash.
+     * @param hash The mixed hash.
+     * @return Index of the first slot to probe.
+     */
+    std::size_t home_of(std::size_t hash) const;
+    /**
+     * @brief Finds the slot holding a key.
+     * @param key The key to search for.
+     * @param hash The mixed hash of the key.
+     * @return Index of the slot, or capacity if the key is absent.
+     */
+    std::size_t locate(const Key& key, std::size_t hash) const;
+    /**
+     * @brief Doubles the table (or allocates the first one) and reinserts every entry.
+     */
+    void grow();
+
+public:
+    /**
+     * @brief Default constructor. Creates an empty index without allocating.
+     */
+    List_Index();
+    /**
+     * @brief Destructor. Frees the table.
+     */
+    ~List_Index();
+    /**
+     * @brief Copying is disabled: the stored iterators belong to one specific list.
+     */
+    List_Index(const List_Index&) = delete;
+    /**
+     * @brief Copy assignment is disabled: the stored iterators belong to one specific list.
+     */
+    List_Index& operator=(const List_Index&) = delete;
+    /**
+     * @brief Returns the number of indexed keys.
+     * @return The number of keys.
+     */
+    [[nodiscard]] std::size_t get_size() const;
+    /**
+     * @brief Returns the number of slots in the table.
+     * @return The table capacity.
+     */
+    [[nodiscard]] std::size_t get_capacity() const;
+    /**
+     * @brief Grows the table so that it holds at least n keys without rehashing.
+     * @param n The number of keys to make room for.
+     */
+    void reserve(std::size_t n);
+    /**
+     * @brief Looks up a key.
+     * @param key The key to search for.
+     * @param position Output: iterator to the node holding the key, if found.
+     * @return True if the key is indexed, false otherwise.
+     */
+    bool find(const Key& key, Iterator& position) const;
+    /**
+     * @brief Indexes a list node. Its key must not be indexed already.
+     * @param position Iterator to the node to index.
+     */
+    void insert(Iterator position);
+    /**
+     * @brief Repoints an indexed key at another node holding an equal key.
+     * @param position Iterator to the new node.
+     * @return True if the key was indexed, false otherwise.
+     */
+    bool update(Iterator position);
+    /**
+     * @brief Removes a key from the index.
+     * @param key The key to remove.
+     * @return True if the key was indexed, false otherwise.
+     */
+    bool erase(const Key& key);
+    /**
+     * @brief Removes every key, keeping the table allocated.
+     */
+    void clear();
+};
+
+#include "List_Index.tpp"
+
+#endif // LIST_INDEX_H
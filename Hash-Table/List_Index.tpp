@@ -0,0 +1,140 @@
+/**
+ * @file List_Index.tpp
+ * @brief Implementation file for the List_Index template class.
+ * @see List_Index.h for class documentation.
+ */
+
+#include "List_Index.hpp"
+
+template <class Key, class Iterator, class KeyOf, class Hash, class KeyEqual>
+List_Index<Key, Iterator, KeyOf, Hash, KeyEqual>::List_Index() : slots(nullptr), capacity(0), count(0) {}
+
+template <class Key, class Iterator, class KeyOf, class Hash, class KeyEqual>
+List_Index<Key, Iterator, KeyOf, Hash, KeyEqual>::~List_Index() {
+    delete[] slots;
+}
+
+template <class Key, class Iterator, class KeyOf, class Hash, class KeyEqual>
+std::size_t List_Index<Key, Iterator, KeyOf, Hash, KeyEqual>::hash_of(const Key& key) const {
+    // Fibonacci hashing spreads weak hashes (e.g. identity on integers) over the high bits
+    const std::uint64_t mixed = static_cast<std::uint64_t>(hasher(key)) * 0x9E3779B97F4A7C15ULL;
+    const std::size_t hash = static_cast<std::size_t>(mixed ^ (mixed >> 32));
+    return (hash != 0) ? hash : 1;
+}
+
+template <class Key, class Iterator, class KeyOf, class Hash, class KeyEqual>
+std::size_t List_Index<Key, Iterator, KeyOf, Hash, KeyEqual>::home_of(const std::size_t hash) const {
+    return hash & (capacity - 1);
+}
+
+template <class Key, class Iterator, class KeyOf, class Hash, class KeyEqual>
+std::size_t List_Index<Key, Iterator, KeyOf, Hash, KeyEqual>::locate(const Key& key, const std::size_t hash) const {
+    if (count == 0) {
+        return capacity;
+    }
+    for (std::size_t i = home_of(hash); slots[i].hash != 0; i = (i + 1) & (capacity - 1)) {
+        if (slots[i].hash == hash && equal(key_of(slots[i].position), key)) {
+            return i;
+        }
+    }
+    return capacity;
+}
+
+template <class Key, class Iterator, class KeyOf, class Hash, class KeyEqual>
+void List_Index<Key, Iterator, KeyOf, Hash, KeyEqual>::grow() {
+    slot* old_slots = slots;
+    const std::size_t old_capacity = capacity;
+    capacity = (capacity == 0) ? 16 : capacity * 2;
+    slots = new slot[capacity]();
+    for (std::size_t i = 0; i < old_capacity; ++i) {
+        if (old_slots[i].hash != 0) {
+            std::size_t j = home_of(old_slots[i].hash);
+            while (slots[j].hash != 0) {
+                j = (j + 1) & (capacity - 1);
+            }
+            slots[j] = old_slots[i];
+        }
+    }
+    delete[] old_slots;
+}
+
+template <class Key, class Iterator, class KeyOf, class Hash, class KeyEqual>
+std::size_t List_Index<Key, Iterator, KeyOf, Hash, KeyEqual>::get_size() const {
+    return count;
+}
+
+template <class Key, class Iterator, class KeyOf, class Hash, class KeyEqual>
+std::size_t List_Index<Key, Iterator, KeyOf, Hash, KeyEqual>::get_capacity() const {
+    return capacity;
+}
+
+template <class Key, class Iterator, class KeyOf, class Hash, class KeyEqual>
+void List_Index<Key, Iterator, KeyOf, Hash, KeyEqual>::reserve(const std::size_t n) {
+    while (n > capacity / 4 * 3) {
+        grow();
+    }
+}
+
+template <class Key, class Iterator, class KeyOf, class Hash, class KeyEqual>
+bool List_Index<Key, Iterator, KeyOf, Hash, KeyEqual>::find(const Key& key, Iterator& position) const {
+    const std::size_t i = locate(key, hash_of(key));
+    if (i == capacity) {
+        return false;
+    }
+    position = slots[i].position;
+    return true;
+}
+
+template <class Key, class Iterator, class KeyOf, class Hash, class KeyEqual>
+void List_Index<Key, Iterator, KeyOf, Hash, KeyEqual>::insert(Iterator position) {
+    reserve(count + 1);
+    const std::size_t hash = hash_of(key_of(position));
+    std::size_t i = home_of(hash);
+    while (slots[i].hash != 0) {
+        i = (i + 1) & (capacity - 1);
+    }
+    slots[i].hash = hash;
+    slots[i].position = position;
+    ++count;
+}
+
+template <class Key, class Iterator, class KeyOf, class Hash, class KeyEqual>
+bool List_Index<Key, Iterator, KeyOf, Hash, KeyEqual>::update(Iterator position) {
+    const Key& key = key_of(position);
+    const std::size_t i = locate(key, hash_of(key));
+    if (i == capacity) {
+        return false;
+    }
+    slots[i].position = position;
+    return true;
+}
+
+template <class Key, class Iterator, class KeyOf, class Hash, class KeyEqual>
+bool List_Index<Key, Iterator, KeyOf, Hash, KeyEqual>::erase(const Key& key) {
+    std::size_t hole = locate(key, hash_of(key));
+    if (hole == capacity) {
+        return false;
+    }
+    // Backward-shift deletion: pull later entries of the probe run into the hole
+    const std::size_t mask = capacity - 1;
+    for (std::size_t i = (hole + 1) & mask; slots[i].hash != 0; i = (i + 1) & mask) {
+        const std::size_t home = home_of(slots[i].hash);
+        if (((i - home) & mask) >= ((i - hole) & mask)) {
+            slots[hole] = slots[i];
+            hole = i;
+        }
+    }
+    slots[hole].hash = 0;
+    slots[hole].position = Iterator();
+    --count;
+    return true;
+}
+
+template <class Key, class Iterator, class KeyOf, class Hash, class KeyEqual>
+void List_Index<Key, Iterator, KeyOf, Hash, KeyEqual>::clear() {
+    for (std::size_t i = 0; i < capacity; ++i) {
+        slots[i].hash = 0;
+        slots[i].position = Iterator();
+    }
+    count = 0;
+}
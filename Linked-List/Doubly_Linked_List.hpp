@@ -9,6 +9,10 @@
 #include <iostream>
 #include <initializer_list>
 #include <stdexcept>
+#include <functional>
+#include <vector>
+#include <utility>
+#include <algorithm>
 
 /**
  * @class Doubly_Linked_List
@@ -30,6 +34,46 @@ private:
     node* front; ///< Pointer to the first node in the list.
     node* back;  ///< Pointer to the last node in the list.
     unsigned long long length; ///< Number of elements in the list.
+    node* finger; ///< Last node reached by index, or nullptr if the cache is empty.
+    unsigned long long finger_index; ///< Index of the finger node.
+
+    /**
+     * @brief Finds the node at an index, starting from whichever of front, back or the
+     *        finger is closest, and moves the finger there.
+     * @param index The index of the node. Must be less than the length.
+     * @return Pointer to the node at the given index.
+     */
+    node* locate(unsigned long long index);
+    /**
+     * @brief Links a detached node into the list before the given node.
+     * @param pos The node to insert before, or nullptr to append.
+     * @param new_node The node to link. Its next and prev pointers are overwritten.
+     */
+    void link_before(node* pos, node* new_node);
+    /**
+     * @brief Detaches a node from the list without freeing it.
+     * @param old_node The node to unlink.
+     */
+    void unlink(node* old_node);
+    /**
+     * @brief Moves the chain [first, last] of another list before pos in O(1).
+     * @param pos The node to insert before, or nullptr to append.
+     * @param other The list that currently owns the chain.
+     * @param first The first node of the chain.
+     * @param last The last node of the chain (inclusive).
+     * @param count The number of nodes in the chain.
+     */
+    void splice_chain(node* pos, Doubly_Linked_List& other, node* first, node* last, unsigned long long count);
+    /**
+     * @brief Stably merges two sorted chains linked through next, without allocating.
+     * @tparam Compare Strict weak ordering on T.
+     * @param a Head of the first chain. Wins ties.
+     * @param b Head of the second chain.
+     * @param comp The comparator.
+     * @return Head of the merged chain.
+     */
+    template <class Compare>
+    static node* merge_chains(node* a, node* b, Compare& comp);
 
 public:
     /**
@@ -109,12 +153,59 @@ public:
      * @brief Reverses the order of the elements in the list.
      */
     void reverse();
+    /**
+     * @brief Sorts the list with a stable bottom-up merge sort in O(n log n).
+     *
+     * Nodes are relinked in place: no element is copied and no memory is allocated.
+     *
+     * @tparam Compare Strict weak ordering on T.
+     * @param comp The comparator (std::less<T> by default).
+     */
+    template <class Compare = std::less<T>>
+    void sort(Compare comp = Compare());
+    /**
+     * @brief Merges another sorted list into this sorted list in O(n + m). Nodes of other are relinked, not copied.
+     *
+     * The merge is stable: for equivalent elements, those of this list come first.
+     *
+     * @tparam Compare Strict weak ordering on T, the one both lists are sorted by.
+     * @param other The list to merge from. Left empty.
+     * @param comp The comparator (std::less<T> by default).
+     */
+    template <class Compare = std::less<T>>
+    void merge(Doubly_Linked_List& other, Compare comp = Compare());
+    /**
+     * @brief Removes all but the first element of every run of equivalent consecutive elements.
+     * @tparam BinaryPredicate Callable comparing two elements for equivalence.
+     * @param pred The predicate (std::equal_to<T> by default).
+     * @return The number of elements removed.
+     */
+    template <class BinaryPredicate = std::equal_to<T>>
+    unsigned long long unique(BinaryPredicate pred = BinaryPredicate());
+    /**
+     * @brief Relinearizes the list so that traversal visits nodes in ascending address order.
+     *
+     * After many inserts and erases the nodes of a long-lived list end up scattered in the
+     * heap in an order unrelated to the list order, so every step of a traversal is a
+     * random memory access. compact() keeps the existing node allocations but moves the
+     * elements between them (with std::swap, never copying) and relinks the nodes by
+     * address, turning traversal into a forward sweep through memory. O(n log n) time and
+     * O(n) temporary memory.
+     *
+     * Element values and their order are preserved; iterators and references to elements
+     * are invalidated because elements may now live in a different node.
+     */
+    void compact();
     /**
      * @brief Prints the contents of the list to standard output.
      */
     void print() const;
     /**
      * @brief Provides random access to elements by index.
+     *
+     * The walk starts from the nearest of front, back and the last accessed position,
+     * so accessing neighbouring indices in sequence costs O(1) per call.
+     *
      * @param index The index of the element.
      * @return Reference to the element at the given index.
      * @throws std::out_of_range if the index is invalid.
@@ -136,6 +227,7 @@ public:
     private:
         node* curr; ///< Pointer to the current node.
         Doubly_Linked_List<T>* list; ///< Pointer to the parent list.
+        friend class Doubly_Linked_List<T>;
     public:
         /**
          * @brief Constructs an iterator for a given node and list.
@@ -212,6 +304,135 @@ public:
      * @return Iterator to one past the last element.
      */
     Iterator end();
+
+    /**
+     * @class Node_Handle
+     * @brief Move-only owner of a node extracted from a list.
+     *
+     * A handle keeps the element in its original allocation so it can be re-inserted
+     * into any Doubly_Linked_List<T> without freeing and reallocating the node.
+     */
+    class Node_Handle {
+    private:
+        node* ptr; ///< The owned node, or nullptr if the handle is empty.
+        friend class Doubly_Linked_List<T>;
+        /**
+         * @brief Takes ownership of a detached node.
+         * @param p The node to own.
+         */
+        explicit Node_Handle(node* p);
+    public:
+        /**
+         * @brief Default constructor. Creates an empty handle.
+         */
+        Node_Handle();
+        /**
+         * @brief Destructor. Frees the owned node, if any.
+         */
+        ~Node_Handle();
+        /**
+         * @brief Move constructor.
+         * @param other The handle to take the node from. Left empty.
+         */
+        Node_Handle(Node_Handle&& other) noexcept;
+        /**
+         * @brief Move assignment operator.
+         * @param other The handle to take the node from. Left empty.
+         * @return Reference to this handle.
+         */
+        Node_Handle& operator=(Node_Handle&& other) noexcept;
+        Node_Handle(const Node_Handle&) = delete;
+        Node_Handle& operator=(const Node_Handle&) = delete;
+        /**
+         * @brief Checks if the handle owns a node.
+         * @return True if the handle is empty, false otherwise.
+         */
+        [[nodiscard]] bool empty() const;
+        /**
+         * @brief Accesses the element stored in the owned node.
+         * @return Reference to the element.
+         * @throws std::runtime_error if the handle is empty.
+         */
+        T& value();
+    };
+
+    /**
+     * @brief Inserts an element before the given position in O(1).
+     * @param pos Iterator to insert before; end() appends.
+     * @param new_item The element to insert.
+     * @return Iterator to the inserted element.
+     */
+    Iterator insert(Iterator pos, T new_item);
+    /**
+     * @brief Removes the element at the given position in O(1).
+     * @param pos Iterator to the element to remove.
+     * @return Iterator to the element that followed the removed one, or end().
+     * @throws std::runtime_error if pos is end().
+     */
+    Iterator erase(Iterator pos);
+    /**
+     * @brief Moves every element of another list before pos in O(1).
+     * @param pos Iterator to insert before; end() appends.
+     * @param other The list to take the elements from. Left empty.
+     */
+    void splice(Iterator pos, Doubly_Linked_List& other);
+    /**
+     * @brief Moves one element of another list (or this list) before pos in O(1).
+     * @param pos Iterator to insert before; end() appends.
+     * @param other The list that owns the element.
+     * @param it Iterator to the element to move.
+     */
+    void splice(Iterator pos, Doubly_Linked_List& other, Iterator it);
+    /**
+     * @brief Moves the range [first, last) of another list (or this list) before pos.
+     *
+     * The relinking is O(1). When other is a different list the range is walked once to
+     * keep both lengths exact, so the call is O(distance(first, last)) in that case.
+     * pos must not lie inside [first, last).
+     *
+     * @param pos Iterator to insert before; end() appends.
+     * @param other The list that owns the range.
+     * @param first Iterator to the first element to move.
+     * @param last Iterator to one past the last element to move.
+     */
+    void splice(Iterator pos, Doubly_Linked_List& other, Iterator first, Iterator last);
+    /**
+     * @brief Unlinks the element at pos and hands its node to the caller in O(1).
+     * @param pos Iterator to the element to extract.
+     * @return A handle owning the extracted node.
+     * @throws std::runtime_error if pos is end().
+     */
+    Node_Handle extract(Iterator pos);
+    /**
+     * @brief Links the node owned by a handle before pos in O(1), without reallocating.
+     * @param pos Iterator to insert before; end() appends.
+     * @param handle The handle to take the node from. Left empty.
+     * @return Iterator to the inserted element, or end() if the handle was empty.
+     */
+    Iterator insert(Iterator pos, Node_Handle&& handle);
+    /**
+     * @brief Applies a function to every element, front to back.
+     * @tparam Function Callable taking a T&.
+     * @param fn The function to apply.
+     */
+    template <class Function>
+    void for_each(Function fn);
+    /**
+     * @brief Finds the first element equal to a value.
+     * @param value The value to search for.
+     * @return Iterator to the first matching element, or end() if there is none.
+     */
+    Iterator find(const T& value);
+    /**
+     * @brief Folds every element into an accumulator, front to back.
+     * @tparam U The accumulator type.
+     * @tparam BinaryOperation Callable combining a U and a const T& into a U.
+     * @param init The initial accumulator value.
+     * @param op The folding operation (addition by default).
+     * @return The final accumulator value.
+     */
+    template <class U, class BinaryOperation = std::plus<>>
+    U accumulate(U init, BinaryOperation op = BinaryOperation());
 };
 
 #include "Doubly_Linked_List.tpp"
@@ -5,7 +5,7 @@
 #include "Doubly_Linked_List.hpp"
 
 template<class T>
-Doubly_Linked_List<T>::Doubly_Linked_List() : front(nullptr), back(nullptr), length(0) {}
+Doubly_Linked_List<T>::Doubly_Linked_List() : front(nullptr), back(nullptr), length(0), finger(nullptr), finger_index(0) {}
 
 template<class T>
 Doubly_Linked_List<T>::~Doubly_Linked_List() {
@@ -13,7 +13,7 @@ Doubly_Linked_List<T>::~Doubly_Linked_List() {
 }
 
 template<class T>
-Doubly_Linked_List<T>::Doubly_Linked_List(std::initializer_list<T> array) : front(nullptr), back(nullptr), length(0) {
+Doubly_Linked_List<T>::Doubly_Linked_List(std::initializer_list<T> array) : front(nullptr), back(nullptr), length(0), finger(nullptr), finger_index(0) {
     for (const T& item : array) {
         push_back(item);
     }
@@ -29,7 +29,7 @@ Doubly_Linked_List<T> &Doubly_Linked_List<T>::operator=(std::initializer_list<T>
 }
 
 template<class T>
-Doubly_Linked_List<T>::Doubly_Linked_List(const Doubly_Linked_List &other) : front(nullptr), back(nullptr), length(0) {
+Doubly_Linked_List<T>::Doubly_Linked_List(const Doubly_Linked_List &other) : front(nullptr), back(nullptr), length(0), finger(nullptr), finger_index(0) {
     node* temp = other.front;
     while (temp != nullptr) {
         this->push_back(temp->item);
@@ -87,6 +87,7 @@ void Doubly_Linked_List<T>::push_front(T new_item) {
         new_node->next = front;
         front = new_node;
     }
+    ++finger_index;
     ++length;
 }
 
@@ -103,19 +104,7 @@ void Doubly_Linked_List<T>::insert(const unsigned long long index, T new_item) {
         push_back(new_item);
     }
     else {
-        node* temp;
-        if (index <= length / 2) {
-            temp = front;
-            for (unsigned long long i = 0; i < index; ++i) {
-                temp = temp->next;
-            }
-        }
-        else {
-            temp = back;
-            for (unsigned long long i = length - 1; i > index; --i) {
-                temp = temp->prev;
-            }
-        }
+        node* temp = locate(index);
 
         node* new_node = new node;
         new_node->item = new_item;
@@ -124,6 +113,7 @@ void Doubly_Linked_List<T>::insert(const unsigned long long index, T new_item) {
         temp->prev->next = new_node;
         temp->prev = new_node;
 
+        finger = new_node;
         ++length;
     }
 }
@@ -132,6 +122,9 @@ template<class T>
 void Doubly_Linked_List<T>::pop_back() {
     if (empty()) return;
     const node* temp = back;
+    if (finger == back) {
+        finger = nullptr;
+    }
     if (front == back) {
         front = back = nullptr;
     } else {
@@ -146,6 +139,11 @@ template<class T>
 void Doubly_Linked_List<T>::pop_front() {
     if (empty()) return;
     const node* temp = front;
+    if (finger == front) {
+        finger = nullptr;
+    } else {
+        --finger_index;
+    }
     if (front == back) {
         front = back = nullptr;
     } else {
@@ -171,19 +169,8 @@ void Doubly_Linked_List<T>::erase(const unsigned long long index) {
         return;
     }
 
-    node* temp;
-    if (index <= (length / 2)) {
-        temp = front;
-        for (unsigned long long i = 0; i < index; ++i) {
-            temp = temp->next;
-        }
-    }
-    else {
-        temp = back;
-        for (unsigned long long i = (length - 1); i > index; --i) {
-            temp = temp->prev;
-        }
-    }
+    node* temp = locate(index);
+    finger = temp->next;
     temp->next->prev = temp->prev;
     temp->prev->next = temp->next;
     delete temp;
@@ -199,6 +186,7 @@ void Doubly_Linked_List<T>::clear() {
         current = next_node;
     }
     front = back = nullptr;
+    finger = nullptr;
     length = 0;
 }
 
@@ -223,6 +211,9 @@ void Doubly_Linked_List<T>::reverse() {
     temp = front;
     front = back;
     back = temp;
+
+    // The finger keeps its node, which is now counted from the other end
+    finger_index = length - 1 - finger_index;
 }
 
 template<class T>
@@ -326,22 +317,43 @@ typename Doubly_Linked_List<T>::Iterator Doubly_Linked_List<T>::end() {
 
 template<class T>
 T &Doubly_Linked_List<T>::operator[](const long long index) {
-    if (index < 0 || index >= length) {
+    if (index < 0 || static_cast<unsigned long long>(index) >= length) {
         throw std::out_of_range("Index out of range");
     }
-    if (index < length / 2) {
-        Iterator temp(front, this);
-        for (long long i = 0; i < index; ++i) {
-            ++temp;
-        }
-        return *temp;
-    } else {
-        Iterator temp(back, this);
-        for (long long i = length - 1; i > index; --i) {
-            --temp;
+    return locate(static_cast<unsigned long long>(index))->item;
+}
+
+template<class T>
+typename Doubly_Linked_List<T>::node *Doubly_Linked_List<T>::locate(const unsigned long long index) {
+    // Pick the closest starting point among front, back and the finger
+    node* temp = front;
+    unsigned long long pos = 0;
+    unsigned long long best = index;
+    if (length - 1 - index < best) {
+        temp = back;
+        pos = length - 1;
+        best = length - 1 - index;
+    }
+    if (finger != nullptr) {
+        const unsigned long long delta = (finger_index > index) ? finger_index - index : index - finger_index;
+        if (delta < best) {
+            temp = finger;
+            pos = finger_index;
         }
-        return *temp;
     }
+
+    while (pos < index) {
+        temp = temp->next;
+        ++pos;
+    }
+    while (pos > index) {
+        temp = temp->prev;
+        --pos;
+    }
+
+    finger = temp;
+    finger_index = index;
+    return temp;
 }
 
 template<class T>
@@ -350,4 +362,346 @@ T &Doubly_Linked_List<T>::at(const long long index) {
         throw std::out_of_range("Index out of range");
     }
     return operator[](index);
-} 
\ No newline at end of file
+} 
+template<class T>
+void Doubly_Linked_List<T>::link_before(node *pos, node *new_node) {
+    node* before = (pos != nullptr) ? pos->prev : back;
+    new_node->next = pos;
+    new_node->prev = before;
+    if (before != nullptr) {
+        before->next = new_node;
+    } else {
+        front = new_node;
+    }
+    if (pos != nullptr) {
+        pos->prev = new_node;
+    } else {
+        back = new_node;
+    }
+    finger = nullptr;
+    ++length;
+}
+
+template<class T>
+void Doubly_Linked_List<T>::unlink(node *old_node) {
+    if (old_node->prev != nullptr) {
+        old_node->prev->next = old_node->next;
+    } else {
+        front = old_node->next;
+    }
+    if (old_node->next != nullptr) {
+        old_node->next->prev = old_node->prev;
+    } else {
+        back = old_node->prev;
+    }
+    old_node->next = old_node->prev = nullptr;
+    finger = nullptr;
+    --length;
+}
+
+template<class T>
+void Doubly_Linked_List<T>::splice_chain(node *pos, Doubly_Linked_List &other, node *first, node *last, const unsigned long long count) {
+    // Detach [first, last] from other
+    if (first->prev != nullptr) {
+        first->prev->next = last->next;
+    } else {
+        other.front = last->next;
+    }
+    if (last->next != nullptr) {
+        last->next->prev = first->prev;
+    } else {
+        other.back = first->prev;
+    }
+    other.length -= count;
+    other.finger = nullptr;
+
+    // Link it before pos in this list
+    node* before = (pos != nullptr) ? pos->prev : back;
+    first->prev = before;
+    last->next = pos;
+    if (before != nullptr) {
+        before->next = first;
+    } else {
+        front = first;
+    }
+    if (pos != nullptr) {
+        pos->prev = last;
+    } else {
+        back = last;
+    }
+    finger = nullptr;
+    length += count;
+}
+
+template<class T>
+typename Doubly_Linked_List<T>::Iterator Doubly_Linked_List<T>::insert(Iterator pos, T new_item) {
+    node* new_node = new node{nullptr, nullptr, new_item};
+    link_before(pos.curr, new_node);
+    return Iterator(new_node, this);
+}
+
+template<class T>
+typename Doubly_Linked_List<T>::Iterator Doubly_Linked_List<T>::erase(Iterator pos) {
+    if (pos.curr == nullptr) {
+        throw std::runtime_error("Cannot erase end() iterator");
+    }
+    node* next_node = pos.curr->next;
+    unlink(pos.curr);
+    delete pos.curr;
+    return Iterator(next_node, this);
+}
+
+template<class T>
+void Doubly_Linked_List<T>::splice(Iterator pos, Doubly_Linked_List &other) {
+    if (this == &other || other.empty()) return;
+    splice_chain(pos.curr, other, other.front, other.back, other.length);
+}
+
+template<class T>
+void Doubly_Linked_List<T>::splice(Iterator pos, Doubly_Linked_List &other, Iterator it) {
+    if (it.curr == nullptr) {
+        throw std::runtime_error("Cannot splice end() iterator");
+    }
+    if (this == &other && (pos.curr == it.curr || pos.curr == it.curr->next)) return;
+    splice_chain(pos.curr, other, it.curr, it.curr, 1);
+}
+
+template<class T>
+void Doubly_Linked_List<T>::splice(Iterator pos, Doubly_Linked_List &other, Iterator first, Iterator last) {
+    if (first == last) return;
+    if (first.curr == nullptr) {
+        throw std::runtime_error("Cannot splice from end() iterator");
+    }
+    node* tail = (last.curr != nullptr) ? last.curr->prev : other.back;
+    if (this == &other) {
+        if (pos == last) return;
+        splice_chain(pos.curr, other, first.curr, tail, 0);
+        return;
+    }
+    unsigned long long count = 1;
+    for (node* temp = first.curr; temp != tail; temp = temp->next) {
+        ++count;
+    }
+    splice_chain(pos.curr, other, first.curr, tail, count);
+}
+
+template<class T>
+typename Doubly_Linked_List<T>::Node_Handle Doubly_Linked_List<T>::extract(Iterator pos) {
+    if (pos.curr == nullptr) {
+        throw std::runtime_error("Cannot extract end() iterator");
+    }
+    unlink(pos.curr);
+    return Node_Handle(pos.curr);
+}
+
+template<class T>
+typename Doubly_Linked_List<T>::Iterator Doubly_Linked_List<T>::insert(Iterator pos, Node_Handle &&handle) {
+    if (handle.ptr == nullptr) {
+        return end();
+    }
+    node* new_node = handle.ptr;
+    handle.ptr = nullptr;
+    link_before(pos.curr, new_node);
+    return Iterator(new_node, this);
+}
+
+template<class T>
+Doubly_Linked_List<T>::Node_Handle::Node_Handle(node *p) : ptr(p) {}
+
+template<class T>
+Doubly_Linked_List<T>::Node_Handle::Node_Handle() : ptr(nullptr) {}
+
+template<class T>
+Doubly_Linked_List<T>::Node_Handle::~Node_Handle() {
+    delete ptr;
+}
+
+template<class T>
+Doubly_Linked_List<T>::Node_Handle::Node_Handle(Node_Handle &&other) noexcept : ptr(other.ptr) {
+    other.ptr = nullptr;
+}
+
+template<class T>
+typename Doubly_Linked_List<T>::Node_Handle &Doubly_Linked_List<T>::Node_Handle::operator=(Node_Handle &&other) noexcept {
+    if (this != &other) {
+        delete ptr;
+        ptr = other.ptr;
+        other.ptr = nullptr;
+    }
+    return *this;
+}
+
+template<class T>
+bool Doubly_Linked_List<T>::Node_Handle::empty() const {
+    return ptr == nullptr;
+}
+
+template<class T>
+T &Doubly_Linked_List<T>::Node_Handle::value() {
+    if (ptr == nullptr) {
+        throw std::runtime_error("Accessing an empty node handle.");
+    }
+    return ptr->item;
+}
+
+template<class T>
+template<class Compare>
+typename Doubly_Linked_List<T>::node *Doubly_Linked_List<T>::merge_chains(node *a, node *b, Compare &comp) {
+    node* head = nullptr;
+    node** tail = &head;
+    while (a != nullptr && b != nullptr) {
+        if (comp(b->item, a->item)) {
+            *tail = b;
+            b = b->next;
+        } else {
+            *tail = a;
+            a = a->next;
+        }
+        tail = &(*tail)->next;
+    }
+    *tail = (a != nullptr) ? a : b;
+    return head;
+}
+
+template<class T>
+template<class Compare>
+void Doubly_Linked_List<T>::sort(Compare comp) {
+    if (length < 2) return;
+
+    // Sort through the next pointers only; bins[i] holds a sorted run of 2^i nodes
+    node* bins[64] = {};
+    node* rest = front;
+    while (rest != nullptr) {
+        node* run = rest;
+        rest = rest->next;
+        run->next = nullptr;
+        int i = 0;
+        for (; bins[i] != nullptr; ++i) {
+            run = merge_chains(bins[i], run, comp);
+            bins[i] = nullptr;
+        }
+        bins[i] = run;
+    }
+
+    node* result = nullptr;
+    for (node* bin : bins) {
+        if (bin != nullptr) {
+            result = (result == nullptr) ? bin : merge_chains(bin, result, comp);
+        }
+    }
+
+    // Rebuild the prev pointers in one pass
+    front = result;
+    front->prev = nullptr;
+    for (node* temp = front; temp->next != nullptr; temp = temp->next) {
+        temp->next->prev = temp;
+        back = temp->next;
+    }
+    finger = nullptr;
+}
+
+template<class T>
+template<class Compare>
+void Doubly_Linked_List<T>::merge(Doubly_Linked_List &other, Compare comp) {
+    if (this == &other || other.empty()) return;
+    front = merge_chains(front, other.front, comp);
+    length += other.length;
+    other.front = other.back = other.finger = nullptr;
+    other.length = 0;
+
+    front->prev = nullptr;
+    for (node* temp = front; temp->next != nullptr; temp = temp->next) {
+        temp->next->prev = temp;
+        back = temp->next;
+    }
+    if (front->next == nullptr) {
+        back = front;
+    }
+    finger = nullptr;
+}
+
+template<class T>
+template<class BinaryPredicate>
+unsigned long long Doubly_Linked_List<T>::unique(BinaryPredicate pred) {
+    unsigned long long removed = 0;
+    if (empty()) return removed;
+    node* kept = front;
+    while (kept->next != nullptr) {
+        node* candidate = kept->next;
+        if (pred(kept->item, candidate->item)) {
+            kept->next = candidate->next;
+            if (candidate->next != nullptr) {
+                candidate->next->prev = kept;
+            }
+            delete candidate;
+            ++removed;
+        } else {
+            kept = candidate;
+        }
+    }
+    back = kept;
+    finger = nullptr;
+    length -= removed;
+    return removed;
+}
+
+template<class T>
+void Doubly_Linked_List<T>::compact() {
+    if (length < 2) return;
+
+    // Pair every node with the traversal index of the element it currently holds
+    std::vector<std::pair<node*, unsigned long long>> slots;
+    slots.reserve(length);
+    unsigned long long index = 0;
+    for (node* temp = front; temp != nullptr; temp = temp->next) {
+        slots.emplace_back(temp, index++);
+    }
+    std::sort(slots.begin(), slots.end(), [](const std::pair<node*, unsigned long long>& a, const std::pair<node*, unsigned long long>& b) {
+        return std::less<node*>()(a.first, b.first);
+    });
+
+    // Cycle-permute the elements so the j-th lowest address holds the j-th element
+    for (unsigned long long j = 0; j < length; ++j) {
+        while (slots[j].second != j) {
+            const unsigned long long k = slots[j].second;
+            std::swap(slots[j].first->item, slots[k].first->item);
+            std::swap(slots[j].second, slots[k].second);
+        }
+    }
+
+    // Relink the nodes in address order
+    front = slots.front().first;
+    back = slots.back().first;
+    front->prev = nullptr;
+    back->next = nullptr;
+    for (unsigned long long j = 0; j + 1 < length; ++j) {
+        slots[j].first->next = slots[j + 1].first;
+        slots[j + 1].first->prev = slots[j].first;
+    }
+    finger = nullptr;
+}
+
+template<class T>
+template<class Function>
+void Doubly_Linked_List<T>::for_each(Function fn) {
+    for (node* curr = front; curr != nullptr; curr = curr->next) {
+        fn(curr->item);
+    }
+}
+
+template<class T>
+typename Doubly_Linked_List<T>::Iterator Doubly_Linked_List<T>::find(const T &value) {
+    for (node* curr = front; curr != nullptr; curr = curr->next) {
+        if (curr->item == value) {
+            return Iterator(curr, this);
+        }
+    }
+    return end();
+}
+
+template<class T>
+template<class U, class BinaryOperation>
+U Doubly_Linked_List<T>::accumulate(U init, BinaryOperation op) {
+    for_each([&init, &op](const T& item) { init = op(std::move(init), item); });
+    return init;
+}
@@ -0,0 +1,338 @@
+/**
+ * @file Intrusive_List.h
+ * @brief Declaration of an intrusive doubly linked list whose links live inside the stored objects.
+ */
+
+#ifndef INTRUSIVE_LIST_H
+#define INTRUSIVE_LIST_H
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @def INTRUSIVE_LIST_SAFE_MODE
+ * @brief When non-zero, list operations verify hook state and throw std::logic_error on misuse.
+ *
+ * Defaults to enabled in debug builds and disabled when NDEBUG is defined.
+ */
+#ifndef INTRUSIVE_LIST_SAFE_MODE
+#ifdef NDEBUG
+#define INTRUSIVE_LIST_SAFE_MODE 0
+#else
+#define INTRUSIVE_LIST_SAFE_MODE 1
+#endif
+#endif
+
+/**
+ * @class List_Hook
+ * @brief The pair of links an object embeds once for every intrusive list it can belong to.
+ *
+ * A hook is unlinked (both pointers null) unless it is currently in a list. Copying an object
+ * never copies its memberships: a copied hook starts unlinked and assignment leaves it as is.
+ * In safe mode the hook also records which list it is linked into.
+ */
+class List_Hook {
+private:
+    List_Hook* next; ///< Next hook in the list, or nullptr when unlinked.
+    List_Hook* prev; ///< Previous hook in the list, or nullptr when unlinked.
+#if INTRUSIVE_LIST_SAFE_MODE
+    const void* owner; ///< List the hook is linked into, or nullptr when unlinked.
+#endif
+
+    template <class T, List_Hook T::*Hook>
+    friend class Intrusive_List;
+
+public:
+    /**
+     * @brief Default constructor. Creates an unlinked hook.
+     */
+    List_Hook() : next(nullptr), prev(nullptr) {
+#if INTRUSIVE_LIST_SAFE_MODE
+        owner = nullptr;
+#endif
+    }
+    /**
+     * @brief Copy constructor. The copy starts unlinked.
+     */
+    List_Hook(const List_Hook&) : List_Hook() {}
+    /**
+     * @brief Assignment operator. Keeps the current membership.
+     * @return Reference to this hook.
+     */
+    List_Hook& operator=(const List_Hook&) { return *this; }
+    /**
+     * @brief Destructor. In safe mode, asserts that the owner was removed from its list first.
+     */
+    ~List_Hook() {
+#if INTRUSIVE_LIST_SAFE_MODE
+        assert(!is_linked() && "Object destroyed while still linked in an Intrusive_List");
+#endif
+    }
+    /**
+     * @brief Checks whether the hook is currently in a list.
+     * @return True if linked, false otherwise.
+     */
+    [[nodiscard]] bool is_linked() const { return next != nullptr; }
+};
+
+/**
+ * @class Intrusive_List
+ * @brief A generic doubly linked list threading objects through a List_Hook member.
+ *
+ * The list never allocates or copies elements: it links the objects the caller owns,
+ * using the hook selected by the member pointer. An object with several hooks can be in
+ * several lists at once, and any object can be removed in O(1) without a search.
+ * The list must not outlive its elements, and an element must be removed before it is
+ * destroyed. T must be standard-layout so that an object can be found from its hook.
+ *
+ * @tparam T The type of the linked objects.
+ * @tparam Hook Pointer to the List_Hook member of T used by this list.
+ */
+template <class T, List_Hook T::*Hook>
+class Intrusive_List {
+    static_assert(std::is_standard_layout<T>::value, "Intrusive_List requires a standard-layout element type");
+
+private:
+    List_Hook head; ///< Sentinel hook: head.next is the first element, head.prev the last.
+    unsigned long long length; ///< Number of elements in the list.
+
+    /**
+     * @brief Returns the hook of an object used by this list.
+     * @param item The object.
+     * @return Pointer to the hook.
+     */
+    static List_Hook* hook_of(T& item);
+    /**
+     * @brief Returns the byte offset of the hook inside T, computed on first use.
+     * @return The offset of the hook member.
+     */
+    static std::ptrdiff_t hook_offset();
+    /**
+     * @brief Recovers the object that embeds a hook.
+     * @param hook The hook, which must not be the sentinel.
+     * @return Reference to the owning object.
+     */
+    static T& owner_of(List_Hook* hook);
+    /**
+     * @brief Links a hook before another hook of this list.
+     * @param pos The hook to link before (the sentinel links at the back).
+     * @param hook The unlinked hook to insert.
+     */
+    void link_before(List_Hook* pos, List_Hook* hook);
+    /**
+     * @brief Unlinks a hook of this list and resets it.
+     * @param hook The linked hook to remove.
+     */
+    void unlink(List_Hook* hook);
+    /**
+     * @brief Throws in safe mode if a hook is already linked.
+     * @param hook The hook being inserted.
+     * @param where Name of the calling operation, used in the error message.
+     */
+    static void check_unlinked(const List_Hook* hook, const char* where);
+    /**
+     * @brief Throws in safe mode if a hook is not linked into this list.
+     * @param hook The hook being removed or looked up.
+     * @param where Name of the calling operation, used in the error message.
+     */
+    void check_owned(const List_Hook* hook, const char* where) const;
+
+public:
+    /**
+     * @brief Default constructor. Initializes an empty list.
+     */
+    Intrusive_List();
+    /**
+     * @brief Destructor. Unlinks every element; the elements themselves are not touched.
+     */
+    ~Intrusive_List();
+    /**
+     * @brief Copying is disabled: an object has only one hook for this list.
+     */
+    Intrusive_List(const Intrusive_List&) = delete;
+    /**
+     * @brief Copy assignment is disabled: an object has only one hook for this list.
+     */
+    Intrusive_List& operator=(const Intrusive_List&) = delete;
+    /**
+     * @brief Move constructor. Takes over the elements of another list in O(1) (O(n) in safe mode).
+     * @param other The list to move from; left empty.
+     */
+    Intrusive_List(Intrusive_List&& other) noexcept;
+    /**
+     * @brief Move assignment operator. Unlinks the current elements, then takes over the other's.
+     *
+     * O(1), except in safe mode where every element is re-tagged with its new list.
+     * @param other The list to move from; left empty.
+     * @return Reference to this list.
+     */
+    Intrusive_List& operator=(Intrusive_List&& other) noexcept;
+    /**
+     * @brief Returns the number of elements in the list.
+     * @return The length of the list.
+     */
+    [[nodiscard]] unsigned long long get_length() const;
+    /**
+     * @brief Checks if the list is empty.
+     * @return True if the list is empty, false otherwise.
+     */
+    [[nodiscard]] bool empty() const;
+    /**
+     * @brief Links an object at the end of the list.
+     * @param item The object to link.
+     * @throws std::logic_error in safe mode if the object is already linked by this hook.
+     */
+    void push_back(T& item);
+    /**
+     * @brief Links an object at the front of the list.
+     * @param item The object to link.
+     * @throws std::logic_error in safe mode if the object is already linked by this hook.
+     */
+    void push_front(T& item);
+    /**
+     * @brief Unlinks the last object from the list.
+     */
+    void pop_back();
+    /**
+     * @brief Unlinks the first object from the list.
+     */
+    void pop_front();
+    /**
+     * @brief Returns the first object in the list.
+     * @return Reference to the first object.
+     * @throws std::out_of_range if the list is empty.
+     */
+    T& front_item();
+    /**
+     * @brief Returns the last object in the list.
+     * @return Reference to the last object.
+     * @throws std::out_of_range if the list is empty.
+     */
+    T& back_item();
+    /**
+     * @brief Unlinks an object from this list in O(1).
+     * @param item An object currently linked in this list.
+     * @throws std::logic_error in safe mode if the object is not linked into this list.
+     */
+    void remove(T& item);
+    /**
+     * @brief Unlinks every object from the list.
+     */
+    void clear();
+
+    /**
+     * @class Iterator
+     * @brief Bidirectional iterator over the linked objects.
+     */
+    class Iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag; ///< Iterator category tag.
+        using value_type = T;                                      ///< Element type.
+        using difference_type = std::ptrdiff_t;                    ///< Distance type.
+        using pointer = T*;                                        ///< Pointer to element.
+        using reference = T&;                                      ///< Reference to element.
+    private:
+        List_Hook* curr; ///< Pointer to the current hook (the sentinel for end()).
+        Intrusive_List<T, Hook>* list; ///< Pointer to the parent list.
+
+        friend class Intrusive_List<T, Hook>;
+    public:
+        /**
+         * @brief Constructs an iterator for a given hook and list.
+         * @param p Pointer to the hook.
+         * @param l Pointer to the parent list.
+         */
+        Iterator(List_Hook* p, Intrusive_List<T, Hook>* l);
+        /**
+         * @brief Default constructor. Creates a singular iterator.
+         */
+        Iterator();
+        /**
+         * @brief Checks if two iterators are equal.
+         * @param other The iterator to compare with.
+         * @return True if equal, false otherwise.
+         */
+        bool operator==(const Iterator& other) const;
+        /**
+         * @brief Checks if two iterators are not equal.
+         * @param other The iterator to compare with.
+         * @return True if not equal, false otherwise.
+         */
+        bool operator!=(const Iterator& other) const;
+        /**
+         * @brief Dereferences the iterator to access the object.
+         * @return Reference to the object.
+         * @throws std::runtime_error if the iterator is end() or singular.
+         */
+        T& operator*();
+        /**
+         * @brief Advances the iterator to the next object (prefix).
+         * @return Reference to this iterator.
+         */
+        Iterator& operator++();
+        /**
+         * @brief Advances the iterator to the next object (postfix).
+         * @return Iterator before increment.
+         */
+        Iterator operator++(int);
+        /**
+         * @brief Moves the iterator to the previous object (prefix).
+         * @return Reference to this iterator.
+         */
+        Iterator& operator--();
+        /**
+         * @brief Moves the iterator to the previous object (postfix).
+         * @return Iterator before decrement.
+         */
+        Iterator operator--(int);
+        /**
+         * @brief Accesses the object pointer.
+         * @return Pointer to the object.
+         * @throws std::runtime_error if the iterator is end() or singular.
+         */
+        T* operator->();
+    };
+
+    /**
+     * @brief Returns an iterator to the beginning of the list.
+     * @return Iterator to the first object.
+     */
+    Iterator begin();
+    /**
+     * @brief Returns an iterator to the end of the list.
+     * @return Iterator to one past the last object.
+     */
+    Iterator end();
+    /**
+     * @brief Returns an iterator to an object linked in this list in O(1).
+     * @param item An object currently linked in this list.
+     * @return Iterator to the object.
+     * @throws std::logic_error in safe mode if the object is not linked into this list.
+     */
+    Iterator iterator_to(T& item);
+    /**
+     * @brief Links an object before the element an iterator points to.
+     * @param pos Iterator to insert before (end() appends).
+     * @param item The object to link.
+     * @return Iterator to the inserted object.
+     * @throws std::logic_error in safe mode if the object is already linked by this hook.
+     */
+    Iterator insert(Iterator pos, T& item);
+    /**
+     * @brief Unlinks the object an iterator points to.
+     * @param pos Iterator to the object to unlink. Must not be end().
+     * @return Iterator to the object that followed the unlinked one.
+     * @throws std::runtime_error if pos is end().
+     * @throws std::logic_error in safe mode if pos points into another list.
+     */
+    Iterator erase(Iterator pos);
+};
+
+#include "Intrusive_List.tpp"
+
+#endif // INTRUSIVE_LIST_H
@@ -0,0 +1,291 @@
+/**
+ * @file Intrusive_List.tpp
+ * @brief Implementation file for the Intrusive_List template class.
+ * @see Intrusive_List.h for class documentation.
+ */
+
+#include "Intrusive_List.hpp"
+
+template <class T, List_Hook T::*Hook>
+List_Hook* Intrusive_List<T, Hook>::hook_of(T& item) {
+    return &(item.*Hook);
+}
+
+template <class T, List_Hook T::*Hook>
+std::ptrdiff_t Intrusive_List<T, Hook>::hook_offset() {
+    // A standard-layout T has a fixed member layout, so the offset is measured once on
+    // aligned storage; no T is constructed there and nothing is read from it
+    static const std::ptrdiff_t offset = [] {
+        alignas(T) static unsigned char probe[sizeof(T)];
+        T* sample = reinterpret_cast<T*>(probe);
+        return reinterpret_cast<unsigned char*>(&(sample->*Hook)) - probe;
+    }();
+    return offset;
+}
+
+template <class T, List_Hook T::*Hook>
+T& Intrusive_List<T, Hook>::owner_of(List_Hook* hook) {
+    return *reinterpret_cast<T*>(reinterpret_cast<unsigned char*>(hook) - hook_offset());
+}
+
+template <class T, List_Hook T::*Hook>
+void Intrusive_List<T, Hook>::check_unlinked(const List_Hook* hook, const char* where) {
+#if INTRUSIVE_LIST_SAFE_MODE
+    if (hook->is_linked()) {
+        throw std::logic_error(std::string("Object is already linked in ") + where);
+    }
+#else
+    (void)hook;
+    (void)where;
+#endif
+}
+
+template <class T, List_Hook T::*Hook>
+void Intrusive_List<T, Hook>::check_owned(const List_Hook* hook, const char* where) const {
+#if INTRUSIVE_LIST_SAFE_MODE
+    if (!hook->is_linked()) {
+        throw std::logic_error(std::string("Object is not linked in ") + where);
+    }
+    if (hook->owner != this) {
+        throw std::logic_error(std::string("Object is linked in another list in ") + where);
+    }
+#else
+    (void)hook;
+    (void)where;
+#endif
+}
+
+template <class T, List_Hook T::*Hook>
+void Intrusive_List<T, Hook>::link_before(List_Hook* pos, List_Hook* hook) {
+    hook->next = pos;
+    hook->prev = pos->prev;
+    pos->prev->next = hook;
+    pos->prev = hook;
+#if INTRUSIVE_LIST_SAFE_MODE
+    hook->owner = this;
+#endif
+    ++length;
+}
+
+template <class T, List_Hook T::*Hook>
+void Intrusive_List<T, Hook>::unlink(List_Hook* hook) {
+    hook->prev->next = hook->next;
+    hook->next->prev = hook->prev;
+    hook->next = hook->prev = nullptr;
+#if INTRUSIVE_LIST_SAFE_MODE
+    hook->owner = nullptr;
+#endif
+    --length;
+}
+
+template <class T, List_Hook T::*Hook>
+Intrusive_List<T, Hook>::Intrusive_List() : length(0) {
+    head.next = head.prev = &head;
+}
+
+template <class T, List_Hook T::*Hook>
+Intrusive_List<T, Hook>::~Intrusive_List() {
+    clear();
+    head.next = head.prev = nullptr;
+}
+
+template <class T, List_Hook T::*Hook>
+Intrusive_List<T, Hook>::Intrusive_List(Intrusive_List&& other) noexcept : length(0) {
+    head.next = head.prev = &head;
+    *this = std::move(other);
+}
+
+template <class T, List_Hook T::*Hook>
+Intrusive_List<T, Hook>& Intrusive_List<T, Hook>::operator=(Intrusive_List&& other) noexcept {
+    if (this != &other) {
+        clear();
+        if (!other.empty()) {
+            // Rethread the first and last elements onto this sentinel
+            head.next = other.head.next;
+            head.prev = other.head.prev;
+            head.next->prev = &head;
+            head.prev->next = &head;
+#if INTRUSIVE_LIST_SAFE_MODE
+            for (List_Hook* current = head.next; current != &head; current = current->next) {
+                current->owner = this;
+            }
+#endif
+            length = other.length;
+            other.head.next = other.head.prev = &other.head;
+            other.length = 0;
+        }
+    }
+    return *this;
+}
+
+template <class T, List_Hook T::*Hook>
+unsigned long long Intrusive_List<T, Hook>::get_length() const {
+    return length;
+}
+
+template <class T, List_Hook T::*Hook>
+bool Intrusive_List<T, Hook>::empty() const {
+    return length == 0;
+}
+
+template <class T, List_Hook T::*Hook>
+void Intrusive_List<T, Hook>::push_back(T& item) {
+    List_Hook* hook = hook_of(item);
+    check_unlinked(hook, "push_back()");
+    link_before(&head, hook);
+}
+
+template <class T, List_Hook T::*Hook>
+void Intrusive_List<T, Hook>::push_front(T& item) {
+    List_Hook* hook = hook_of(item);
+    check_unlinked(hook, "push_front()");
+    link_before(head.next, hook);
+}
+
+template <class T, List_Hook T::*Hook>
+void Intrusive_List<T, Hook>::pop_back() {
+    if (empty()) return;
+    unlink(head.prev);
+}
+
+template <class T, List_Hook T::*Hook>
+void Intrusive_List<T, Hook>::pop_front() {
+    if (empty()) return;
+    unlink(head.next);
+}
+
+template <class T, List_Hook T::*Hook>
+T& Intrusive_List<T, Hook>::front_item() {
+    if (empty()) {
+        throw std::out_of_range("List is empty in front_item()");
+    }
+    return owner_of(head.next);
+}
+
+template <class T, List_Hook T::*Hook>
+T& Intrusive_List<T, Hook>::back_item() {
+    if (empty()) {
+        throw std::out_of_range("List is empty in back_item()");
+    }
+    return owner_of(head.prev);
+}
+
+template <class T, List_Hook T::*Hook>
+void Intrusive_List<T, Hook>::remove(T& item) {
+    List_Hook* hook = hook_of(item);
+    check_owned(hook, "remove()");
+    unlink(hook);
+}
+
+template <class T, List_Hook T::*Hook>
+void Intrusive_List<T, Hook>::clear() {
+    List_Hook* current = head.next;
+    while (current != &head) {
+        List_Hook* next_hook = current->next;
+        current->next = current->prev = nullptr;
+#if INTRUSIVE_LIST_SAFE_MODE
+        current->owner = nullptr;
+#endif
+        current = next_hook;
+    }
+    head.next = head.prev = &head;
+    length = 0;
+}
+
+template <class T, List_Hook T::*Hook>
+Intrusive_List<T, Hook>::Iterator::Iterator(List_Hook* p, Intrusive_List<T, Hook>* l) : curr(p), list(l) {}
+
+template <class T, List_Hook T::*Hook>
+Intrusive_List<T, Hook>::Iterator::Iterator() : curr(nullptr), list(nullptr) {}
+
+template <class T, List_Hook T::*Hook>
+bool Intrusive_List<T, Hook>::Iterator::operator==(const Iterator& other) const {
+    return curr == other.curr;
+}
+
+template <class T, List_Hook T::*Hook>
+bool Intrusive_List<T, Hook>::Iterator::operator!=(const Iterator& other) const {
+    return curr != other.curr;
+}
+
+template <class T, List_Hook T::*Hook>
+T& Intrusive_List<T, Hook>::Iterator::operator*() {
+    if (curr == nullptr || curr == &list->head) {
+        throw std::runtime_error("Dereferencing a null iterator.");
+    }
+    return owner_of(curr);
+}
+
+template <class T, List_Hook T::*Hook>
+typename Intrusive_List<T, Hook>::Iterator& Intrusive_List<T, Hook>::Iterator::operator++() {
+    if (curr) {
+        curr = curr->next;
+    }
+    return *this;
+}
+
+template <class T, List_Hook T::*Hook>
+typename Intrusive_List<T, Hook>::Iterator Intrusive_List<T, Hook>::Iterator::operator++(int) {
+    Iterator temp = *this;
+    ++(*this);
+    return temp;
+}
+
+template <class T, List_Hook T::*Hook>
+typename Intrusive_List<T, Hook>::Iterator& Intrusive_List<T, Hook>::Iterator::operator--() {
+    if (curr) {
+        curr = curr->prev;
+    }
+    return *this;
+}
+
+template <class T, List_Hook T::*Hook>
+typename Intrusive_List<T, Hook>::Iterator Intrusive_List<T, Hook>::Iterator::operator--(int) {
+    Iterator temp = *this;
+    --(*this);
+    return temp;
+}
+
+template <class T, List_Hook T::*Hook>
+T* Intrusive_List<T, Hook>::Iterator::operator->() {
+    if (curr == nullptr || curr == &list->head) {
+        throw std::runtime_error("Cannot access member via end() iterator");
+    }
+    return &owner_of(curr);
+}
+
+template <class T, List_Hook T::*Hook>
+typename Intrusive_List<T, Hook>::Iterator Intrusive_List<T, Hook>::begin() {
+    return Iterator(head.next, this);
+}
+
+template <class T, List_Hook T::*Hook>
+typename Intrusive_List<T, Hook>::Iterator Intrusive_List<T, Hook>::end() {
+    return Iterator(&head, this);
+}
+
+template <class T, List_Hook T::*Hook>
+typename Intrusive_List<T, Hook>::Iterator Intrusive_List<T, Hook>::iterator_to(T& item) {
+    List_Hook* hook = hook_of(item);
+    check_owned(hook, "iterator_to()");
+    return Iterator(hook, this);
+}
+
+template <class T, List_Hook T::*Hook>
+typename Intrusive_List<T, Hook>::Iterator Intrusive_List<T, Hook>::insert(Iterator pos, T& item) {
+    List_Hook* hook = hook_of(item);
+    check_unlinked(hook, "insert()");
+    link_before(pos.curr, hook);
+    return Iterator(hook, this);
+}
+
+template <class T, List_Hook T::*Hook>
+typename Intrusive_List<T, Hook>::Iterator Intrusive_List<T, Hook>::erase(Iterator pos) {
+    if (pos.curr == nullptr || pos.curr == &head) {
+        throw std::runtime_error("Cannot erase the end() iterator");
+    }
+    check_owned(pos.curr, "erase()");
+    List_Hook* next_hook = pos.curr->next;
+    unlink(pos.curr);
+    return Iterator(next_hook, this);
+}
@@ -9,6 +9,11 @@
 #include <iostream>
 #include <initializer_list>
 #include <stdexcept>
+#include <functional>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <iterator>
 
 /**
  * @class Linked_List
@@ -27,7 +32,18 @@ private:
         T item;     ///< The data stored in the node.
     };
     node* front; ///< Pointer to the first node in the list.
+    node* back;  ///< Pointer to the last node in the list.
     unsigned long long length; ///< Number of elements in the list.
+    /**
+     * @brief Stably merges two sorted chains linked through next, without allocating.
+     * @tparam Compare Strict weak ordering on T.
+     * @param a Head of the first chain. Wins ties.
+     * @param b Head of the second chain.
+     * @param comp The comparator.
+     * @return Head of the merged chain.
+     */
+    template <class Compare>
+    static node* merge_chains(node* a, node* b, Compare& comp);
 
 public:
     /**
@@ -43,6 +59,14 @@ public:
      * @param array The initializer list of elements.
      */
     Linked_List(std::initializer_list<T> array);
+    /**
+     * @brief Constructs a list from an iterator range in a single pass.
+     * @tparam InputIt Input iterator type.
+     * @param first Iterator to the first element to copy.
+     * @param last Iterator to one past the last element to copy.
+     */
+    template <class InputIt, class = typename std::iterator_traits<InputIt>::iterator_category>
+    Linked_List(InputIt first, InputIt last);
     /**
      * @brief Assigns an initializer list to the list.
      * @param array The initializer list of elements.
@@ -60,6 +84,14 @@ public:
      * @return Reference to this list.
      */
     Linked_List& operator=(const Linked_List& other);
+    /**
+     * @brief Replaces the contents of the list with the elements of an iterator range.
+     * @tparam InputIt Input iterator type.
+     * @param first Iterator to the first element to copy.
+     * @param last Iterator to one past the last element to copy.
+     */
+    template <class InputIt, class = typename std::iterator_traits<InputIt>::iterator_category>
+    void assign(InputIt first, InputIt last);
     /**
      * @brief Returns the number of elements in the list.
      * @return The length of the list.
@@ -71,7 +103,7 @@ public:
      */
     [[nodiscard]] bool empty() const;
     /**
-     * @brief Adds an element to the end of the list.
+     * @brief Adds an element to the end of the list in O(1) using the tail pointer.
      * @param new_item The element to add.
      */
     void push_back(T new_item);
@@ -107,6 +139,49 @@ public:
      * @brief Reverses the order of the elements in the list.
      */
     void reverse();
+    /**
+     * @brief Sorts the list with a stable bottom-up merge sort in O(n log n).
+     *
+     * Nodes are relinked in place: no element is copied and no memory is allocated.
+     *
+     * @tparam Compare Strict weak ordering on T.
+     * @param comp The comparator (std::less<T> by default).
+     */
+    template <class Compare = std::less<T>>
+    void sort(Compare comp = Compare());
+    /**
+     * @brief Merges another sorted list into this sorted list in O(n + m). Nodes of other are relinked, not copied.
+     *
+     * The merge is stable: for equivalent elements, those of this list come first.
+     *
+     * @tparam Compare Strict weak ordering on T, the one both lists are sorted by.
+     * @param other The list to merge from. Left empty.
+     * @param comp The comparator (std::less<T> by default).
+     */
+    template <class Compare = std::less<T>>
+    void merge(Linked_List& other, Compare comp = Compare());
+    /**
+     * @brief Removes all but the first element of every run of equivalent consecutive elements.
+     * @tparam BinaryPredicate Callable comparing two elements for equivalence.
+     * @param pred The predicate (std::equal_to<T> by default).
+     * @return The number of elements removed.
+     */
+    template <class BinaryPredicate = std::equal_to<T>>
+    unsigned long long unique(BinaryPredicate pred = BinaryPredicate());
+    /**
+     * @brief Relinearizes the list so that traversal visits nodes in ascending address order.
+     *
+     * After many inserts and erases the nodes of a long-lived list end up scattered in the
+     * heap in an order unrelated to the list order, so every step of a traversal is a
+     * random memory access. compact() keeps the existing node allocations but moves the
+     * elements between them (with std::swap, never copying) and relinks the nodes by
+     * address, turning traversal into a forward sweep through memory. O(n log n) time and
+     * O(n) temporary memory.
+     *
+     * Element values and their order are preserved; iterators and references to elements
+     * are invalidated because elements may now live in a different node.
+     */
+    void compact();
     /**
      * @brief Prints the contents of the list to standard output.
      */
@@ -131,9 +206,17 @@ public:
      * @brief Forward iterator for the singly linked list.
      */
     class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag; ///< Iterator category tag.
+        using value_type = T;                                ///< Element type.
+        using difference_type = std::ptrdiff_t;              ///< Distance type.
+        using pointer = T*;                                  ///< Pointer to element.
+        using reference = T&;                                ///< Reference to element.
     private:
         node* curr; ///< Pointer to the current node.
         Linked_List<T>* list; ///< Pointer to the parent list.
+        bool before_front; ///< True for the position returned by before_begin().
+        friend class Linked_List<T>;
     public:
         /**
          * @brief Constructs an iterator for a given node and list.
@@ -200,6 +283,61 @@ public:
      * @return Iterator to one past the last element.
      */
     Iterator end();
+    /**
+     * @brief Returns an iterator to the position before the first element.
+     *
+     * The iterator must not be dereferenced; it exists so that insert_after() and
+     * erase_after() can operate on the front of the list.
+     *
+     * @return Iterator that yields begin() when incremented.
+     */
+    Iterator before_begin();
+    /**
+     * @brief Inserts an element after the given position in O(1).
+     * @param pos Iterator to an element, or before_begin().
+     * @param new_item The element to insert.
+     * @return Iterator to the inserted element.
+     * @throws std::runtime_error if pos is end().
+     */
+    Iterator insert_after(Iterator pos, T new_item);
+    /**
+     * @brief Removes the element following the given position in O(1).
+     * @param pos Iterator to an element, or before_begin().
+     * @return Iterator to the element that followed the removed one, or end().
+     * @throws std::runtime_error if there is no element after pos.
+     */
+    Iterator erase_after(Iterator pos);
+    /**
+     * @brief Removes every element satisfying a predicate in a single pass.
+     * @tparam Predicate Callable taking a const T& and returning bool.
+     * @param pred The predicate selecting elements to remove.
+     * @return The number of elements removed.
+     */
+    template <class Predicate>
+    unsigned long long remove_if(Predicate pred);
+    /**
+     * @brief Applies a function to every element, front to back.
+     * @tparam Function Callable taking a T&.
+     * @param fn The function to apply.
+     */
+    template <class Function>
+    void for_each(Function fn);
+    /**
+     * @brief Finds the first element equal to a value.
+     * @param value The value to search for.
+     * @return Iterator to the first matching element, or end() if there is none.
+     */
+    Iterator find(const T& value);
+    /**
+     * @brief Folds every element into an accumulator, front to back.
+     * @tparam U The accumulator type.
+     * @tparam BinaryOperation Callable combining a U and a const T& into a U.
+     * @param init The initial accumulator value.
+     * @param op The folding operation (addition by default).
+     * @return The final accumulator value.
+     */
+    template <class U, class BinaryOperation = std::plus<>>
+    U accumulate(U init, BinaryOperation op = BinaryOperation());
 };
 
 #include "Linked_List.tpp"
@@ -7,7 +7,7 @@
 #include "Linked_List.hpp"
 
 template <class T>
-Linked_List<T>::Linked_List() : front(nullptr), length(0) {}
+Linked_List<T>::Linked_List() : front(nullptr), back(nullptr), length(0) {}
 
 template <class T>
 Linked_List<T>::~Linked_List() {
@@ -15,7 +15,7 @@ Linked_List<T>::~Linked_List() {
 }
 
 template <class T>
-Linked_List<T>::Linked_List(std::initializer_list<T> array) : front(nullptr), length(0) {
+Linked_List<T>::Linked_List(std::initializer_list<T> array) : front(nullptr), back(nullptr), length(0) {
     for (const T& item : array) {
         push_back(item);
     }
@@ -31,7 +31,7 @@ Linked_List<T>& Linked_List<T>::operator=(std::initializer_list<T> array) {
 }
 
 template <class T>
-Linked_List<T>::Linked_List(const Linked_List& other) : front(nullptr), length(0) {
+Linked_List<T>::Linked_List(const Linked_List& other) : front(nullptr), back(nullptr), length(0) {
     node* temp = other.front;
     while (temp != nullptr) {
         push_back(temp->item);
@@ -52,6 +52,23 @@ Linked_List<T>& Linked_List<T>::operator=(const Linked_List& other) {
     return *this;
 }
 
+template <class T>
+template <class InputIt, class>
+Linked_List<T>::Linked_List(InputIt first, InputIt last) : front(nullptr), back(nullptr), length(0) {
+    for (; first != last; ++first) {
+        push_back(*first);
+    }
+}
+
+template <class T>
+template <class InputIt, class>
+void Linked_List<T>::assign(InputIt first, InputIt last) {
+    clear();
+    for (; first != last; ++first) {
+        push_back(*first);
+    }
+}
+
 template <class T>
 unsigned long long Linked_List<T>::get_length() const {
     return length;
@@ -66,13 +83,10 @@ template <class T>
 void Linked_List<T>::push_back(T new_item) {
     node* new_node = new node{nullptr, new_item};
     if (empty()) {
-        front = new_node;
+        front = back = new_node;
     } else {
-        node* temp = front;
-        while (temp->next != nullptr) {
-            temp = temp->next;
-        }
-        temp->next = new_node;
+        back->next = new_node;
+        back = new_node;
     }
     ++length;
 }
@@ -81,6 +95,9 @@ template <class T>
 void Linked_List<T>::push_front(T new_item) {
     node* new_node = new node{front, new_item};
     front = new_node;
+    if (back == nullptr) {
+        back = new_node;
+    }
     ++length;
 }
 
@@ -109,14 +126,15 @@ void Linked_List<T>::pop_back() {
     if (empty()) return;
     if (length == 1) {
         delete front;
-        front = nullptr;
+        front = back = nullptr;
     } else {
         node* temp = front;
-        while (temp->next->next != nullptr) {
+        while (temp->next != back) {
             temp = temp->next;
         }
-        delete temp->next;
+        delete back;
         temp->next = nullptr;
+        back = temp;
     }
     --length;
 }
@@ -128,6 +146,9 @@ void Linked_List<T>::pop_front() {
     front = front->next;
     delete temp;
     --length;
+    if (empty()) {
+        back = nullptr;
+    }
 }
 
 template <class T>
@@ -169,6 +190,7 @@ void Linked_List<T>::reverse() {
         prev = current;
         current = next;
     }
+    back = front;
     front = prev;
 }
 
@@ -188,6 +210,9 @@ T& Linked_List<T>::operator[](const long long index) {
     if (index < 0 || static_cast<unsigned long long>(index) >= length) {
         throw std::out_of_range("Index out of range in operator[]");
     }
+    if (static_cast<unsigned long long>(index) == length - 1) {
+        return back->item;
+    }
     node* temp = front;
     for (unsigned long long i = 0; i < index; ++i) {
         temp = temp->next;
@@ -201,4 +226,299 @@ T& Linked_List<T>::at(const long long index) {
         throw std::out_of_range("Index out of range in at()");
     }
     return operator[](index);
-} 
\ No newline at end of file
+}
+
+template <class T>
+Linked_List<T>::Iterator::Iterator(node* p, Linked_List<T>* l) : curr(p), list(l), before_front(false) {}
+
+template <class T>
+Linked_List<T>::Iterator::Iterator() : curr(nullptr), list(nullptr), before_front(false) {}
+
+template <class T>
+Linked_List<T>::Iterator::Iterator(const Iterator& other) : curr(other.curr), list(other.list), before_front(other.before_front) {}
+
+template <class T>
+typename Linked_List<T>::Iterator& Linked_List<T>::Iterator::operator=(const Iterator& other) {
+    if (this != &other) {
+        curr = other.curr;
+        list = other.list;
+        before_front = other.before_front;
+    }
+    return *this;
+}
+
+template <class T>
+bool Linked_List<T>::Iterator::operator==(const Iterator& other) const {
+    return curr == other.curr && before_front == other.before_front;
+}
+
+template <class T>
+bool Linked_List<T>::Iterator::operator!=(const Iterator& other) const {
+    return !(*this == other);
+}
+
+template <class T>
+T& Linked_List<T>::Iterator::operator*() {
+    if (curr == nullptr) {
+        throw std::runtime_error("Dereferencing a null iterator.");
+    }
+    return curr->item;
+}
+
+template <class T>
+typename Linked_List<T>::Iterator& Linked_List<T>::Iterator::operator++() {
+    if (before_front) {
+        curr = list->front;
+        before_front = false;
+    } else if (curr != nullptr) {
+        curr = curr->next;
+    }
+    return *this;
+}
+
+template <class T>
+typename Linked_List<T>::Iterator Linked_List<T>::Iterator::operator++(int) {
+    Iterator temp = *this;
+    ++(*this);
+    return temp;
+}
+
+template <class T>
+T* Linked_List<T>::Iterator::operator->() {
+    if (curr == nullptr) {
+        throw std::runtime_error("Cannot access member via end() iterator");
+    }
+    return &(curr->item);
+}
+
+template <class T>
+typename Linked_List<T>::Iterator Linked_List<T>::begin() {
+    return Iterator(front, this);
+}
+
+template <class T>
+typename Linked_List<T>::Iterator Linked_List<T>::end() {
+    return Iterator(nullptr, this);
+}
+
+template <class T>
+typename Linked_List<T>::Iterator Linked_List<T>::before_begin() {
+    Iterator it(nullptr, this);
+    it.before_front = true;
+    return it;
+}
+
+template <class T>
+typename Linked_List<T>::Iterator Linked_List<T>::insert_after(Iterator pos, T new_item) {
+    if (pos.before_front) {
+        push_front(new_item);
+        return begin();
+    }
+    if (pos.curr == nullptr) {
+        throw std::runtime_error("Cannot insert after end() iterator");
+    }
+    node* new_node = new node{pos.curr->next, new_item};
+    pos.curr->next = new_node;
+    if (pos.curr == back) {
+        back = new_node;
+    }
+    ++length;
+    return Iterator(new_node, this);
+}
+
+template <class T>
+typename Linked_List<T>::Iterator Linked_List<T>::erase_after(Iterator pos) {
+    if (pos.before_front) {
+        if (empty()) {
+            throw std::runtime_error("No element to erase after iterator");
+        }
+        pop_front();
+        return begin();
+    }
+    if (pos.curr == nullptr || pos.curr->next == nullptr) {
+        throw std::runtime_error("No element to erase after iterator");
+    }
+    node* del = pos.curr->next;
+    pos.curr->next = del->next;
+    if (del == back) {
+        back = pos.curr;
+    }
+    delete del;
+    --length;
+    return Iterator(pos.curr->next, this);
+}
+
+template <class T>
+template <class Predicate>
+unsigned long long Linked_List<T>::remove_if(Predicate pred) {
+    unsigned long long removed = 0;
+    node* prev = nullptr;
+    node* current = front;
+    while (current != nullptr) {
+        node* next = current->next;
+        if (pred(static_cast<const T&>(current->item))) {
+            if (prev == nullptr) {
+                front = next;
+            } else {
+                prev->next = next;
+            }
+            delete current;
+            ++removed;
+        } else {
+            prev = current;
+        }
+        current = next;
+    }
+    back = prev;
+    length -= removed;
+    return removed;
+}
+
+template <class T>
+template <class Compare>
+typename Linked_List<T>::node* Linked_List<T>::merge_chains(node* a, node* b, Compare& comp) {
+    node* head = nullptr;
+    node** tail = &head;
+    while (a != nullptr && b != nullptr) {
+        if (comp(b->item, a->item)) {
+            *tail = b;
+            b = b->next;
+        } else {
+            *tail = a;
+            a = a->next;
+        }
+        tail = &(*tail)->next;
+    }
+    *tail = (a != nullptr) ? a : b;
+    return head;
+}
+
+template <class T>
+template <class Compare>
+void Linked_List<T>::sort(Compare comp) {
+    if (length < 2) return;
+
+    // bins[i] holds a sorted run of 2^i nodes; earlier runs sit in higher bins
+    node* bins[64] = {};
+    node* rest = front;
+    while (rest != nullptr) {
+        node* run = rest;
+        rest = rest->next;
+        run->next = nullptr;
+        int i = 0;
+        for (; bins[i] != nullptr; ++i) {
+            run = merge_chains(bins[i], run, comp);
+            bins[i] = nullptr;
+        }
+        bins[i] = run;
+    }
+
+    node* result = nullptr;
+    for (node* bin : bins) {
+        if (bin != nullptr) {
+            result = (result == nullptr) ? bin : merge_chains(bin, result, comp);
+        }
+    }
+
+    front = result;
+    back = result;
+    while (back->next != nullptr) {
+        back = back->next;
+    }
+}
+
+template <class T>
+template <class Compare>
+void Linked_List<T>::merge(Linked_List<T>& other, Compare comp) {
+    if (this == &other || other.empty()) return;
+    if (empty()) {
+        front = other.front;
+        back = other.back;
+    } else {
+        node* new_back = comp(other.back->item, back->item) ? back : other.back;
+        front = merge_chains(front, other.front, comp);
+        back = new_back;
+    }
+    length += other.length;
+    other.front = other.back = nullptr;
+    other.length = 0;
+}
+
+template <class T>
+template <class BinaryPredicate>
+unsigned long long Linked_List<T>::unique(BinaryPredicate pred) {
+    unsigned long long removed = 0;
+    if (empty()) return removed;
+    node* kept = front;
+    while (kept->next != nullptr) {
+        node* candidate = kept->next;
+        if (pred(kept->item, candidate->item)) {
+            kept->next = candidate->next;
+            delete candidate;
+            ++removed;
+        } else {
+            kept = candidate;
+        }
+    }
+    back = kept;
+    length -= removed;
+    return removed;
+}
+
+template <class T>
+void Linked_List<T>::compact() {
+    if (length < 2) return;
+
+    // Pair every node with the traversal index of the element it currently holds
+    std::vector<std::pair<node*, unsigned long long>> slots;
+    slots.reserve(length);
+    unsigned long long index = 0;
+    for (node* temp = front; temp != nullptr; temp = temp->next) {
+        slots.emplace_back(temp, index++);
+    }
+    std::sort(slots.begin(), slots.end(), [](const std::pair<node*, unsigned long long>& a, const std::pair<node*, unsigned long long>& b) {
+        return std::less<node*>()(a.first, b.first);
+    });
+
+    // Cycle-permute the elements so the j-th lowest address holds the j-th element
+    for (unsigned long long j = 0; j < length; ++j) {
+        while (slots[j].second != j) {
+            const unsigned long long k = slots[j].second;
+            std::swap(slots[j].first->item, slots[k].first->item);
+            std::swap(slots[j].second, slots[k].second);
+        }
+    }
+
+    // Relink the nodes in address order
+    front = slots.front().first;
+    back = slots.back().first;
+    for (unsigned long long j = 0; j + 1 < length; ++j) {
+        slots[j].first->next = slots[j + 1].first;
+    }
+    back->next = nullptr;
+}
+
+template <class T>
+template <class Function>
+void Linked_List<T>::for_each(Function fn) {
+    for (node* curr = front; curr != nullptr; curr = curr->next) {
+        fn(curr->item);
+    }
+}
+
+template <class T>
+typename Linked_List<T>::Iterator Linked_List<T>::find(const T& value) {
+    for (node* curr = front; curr != nullptr; curr = curr->next) {
+        if (curr->item == value) {
+            return Iterator(curr, this);
+        }
+    }
+    return end();
+}
+
+template <class T>
+template <class U, class BinaryOperation>
+U Linked_List<T>::accumulate(U init, BinaryOperation op) {
+    for_each([&init, &op](const T& item) { init = op(std::move(init), item); });
+    return init;
+}
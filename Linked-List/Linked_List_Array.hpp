@@ -1,6 +1,6 @@
 /**
  * @file Linked_List_Array.h
- * @brief Declaration of a generic linked list array data structure with iterator support.
+ * @brief Declaration of a generic singly linked list whose nodes live in one contiguous array.
  */
 
 #ifndef LINKED_LIST_ARRAY_H
@@ -9,11 +9,20 @@
 #include <iostream>
 #include <initializer_list>
 #include <stdexcept>
+#include <functional>
+#include <iterator>
+#include <cstdint>
 
 /**
  * @class Linked_List_Array
- * @brief A generic linked list array implementation supporting forward iteration.
- * @tparam T The type of elements stored in the list.
+ * @brief A generic singly linked list backed by a contiguous, growable node pool.
+ *
+ * Nodes are slots of a single array and are linked through 32-bit indices instead of
+ * pointers. Erased slots are threaded onto an internal free list and reused by later
+ * insertions. Growing the pool relocates every node, so references to elements are
+ * invalidated by any insertion that grows the pool (like std::vector).
+ *
+ * @tparam T The type of elements stored in the list. Must be default constructible.
  */
 template <class T>
 class Linked_List_Array {
@@ -23,19 +32,59 @@ private:
      * @brief Internal node structure for the linked list array.
      */
     struct node {
-        node* next; ///< Pointer to the next node.
-        T item;     ///< The data stored in the node.
+        std::uint32_t next; ///< Index of the next node, or npos.
+        T item;             ///< The data stored in the node.
     };
-    node* front; ///< Pointer to the first node in the list.
+    static constexpr std::uint32_t npos = UINT32_MAX; ///< Null index.
+
+    node* pool;              ///< Contiguous array holding every node slot.
+    std::uint32_t capacity;  ///< Number of slots allocated in the pool.
+    std::uint32_t used;      ///< Number of slots handed out at least once (high-water mark).
+    std::uint32_t free_head; ///< Index of the first slot on the free list, or npos.
+    std::uint32_t front;     ///< Index of the first node in the list, or npos.
+    std::uint32_t back;      ///< Index of the last node in the list, or npos.
     unsigned long long length; ///< Number of elements in the list.
 
+    /**
+     * @brief Takes a slot from the free list or the unused tail of the pool, growing it if needed.
+     * @param new_item The element to store in the slot.
+     * @param next The index the new node links to.
+     * @return Index of the initialized slot.
+     * @throws std::length_error if the pool would exceed the 32-bit index range.
+     */
+    std::uint32_t allocate_node(T new_item, std::uint32_t next);
+    /**
+     * @brief Returns a slot to the free list.
+     * @param index Index of the slot to release.
+     */
+    void release_node(std::uint32_t index);
+    /**
+     * @brief Doubles the capacity of the pool, relocating every node.
+     */
+    void grow();
+    /**
+     * @brief Makes this list an exact copy of another, including the pool layout.
+     * @param other The list to copy from.
+     */
+    void copy_from(const Linked_List_Array& other);
+    /**
+     * @brief Stably merges two sorted chains linked through next, without allocating.
+     * @tparam Compare Strict weak ordering on T.
+     * @param a Head of the first chain. Wins ties.
+     * @param b Head of the second chain.
+     * @param comp The comparator.
+     * @return Head of the merged chain.
+     */
+    template <class Compare>
+    std::uint32_t merge_chains(std::uint32_t a, std::uint32_t b, Compare& comp);
+
 public:
     /**
      * @brief Default constructor. Initializes an empty list.
      */
     Linked_List_Array();
     /**
-     * @brief Destructor. Clears the list and frees memory.
+     * @brief Destructor. Frees the node pool.
      */
     ~Linked_List_Array();
     /**
@@ -43,6 +92,14 @@ public:
      * @param array The initializer list of elements.
      */
     Linked_List_Array(std::initializer_list<T> array);
+    /**
+     * @brief Constructs a list from an iterator range in a single pass.
+     * @tparam InputIt Input iterator type.
+     * @param first Iterator to the first element to copy.
+     * @param last Iterator to one past the last element to copy.
+     */
+    template <class InputIt, class = typename std::iterator_traits<InputIt>::iterator_category>
+    Linked_List_Array(InputIt first, InputIt last);
     /**
      * @brief Assigns an initializer list to the list.
      * @param array The initializer list of elements.
@@ -50,7 +107,7 @@ public:
      */
     Linked_List_Array& operator=(std::initializer_list<T> array);
     /**
-     * @brief Copy constructor.
+     * @brief Copy constructor. Copies the pool with a single memcpy for trivially copyable T.
      * @param other The list to copy from.
      */
     Linked_List_Array(const Linked_List_Array& other);
@@ -60,6 +117,14 @@ public:
      * @return Reference to this list.
      */
     Linked_List_Array& operator=(const Linked_List_Array& other);
+    /**
+     * @brief Replaces the contents of the list with the elements of an iterator range.
+     * @tparam InputIt Input iterator type.
+     * @param first Iterator to the first element to copy.
+     * @param last Iterator to one past the last element to copy.
+     */
+    template <class InputIt, class = typename std::iterator_traits<InputIt>::iterator_category>
+    void assign(InputIt first, InputIt last);
     /**
      * @brief Returns the number of elements in the list.
      * @return The length of the list.
@@ -71,7 +136,7 @@ public:
      */
     [[nodiscard]] bool empty() const;
     /**
-     * @brief Adds an element to the end of the list.
+     * @brief Adds an element to the end of the list in O(1) using the tail pointer.
      * @param new_item The element to add.
      */
     void push_back(T new_item);
@@ -100,13 +165,58 @@ public:
      */
     void erase(unsigned long long index);
     /**
-     * @brief Removes all elements from the list.
+     * @brief Removes all elements from the list. The pool is kept for reuse.
+     *
+     * O(1) for trivially copyable T; otherwise every element is reset in O(n) so that
+     * the resources it holds are released immediately.
      */
     void clear();
+    /**
+     * @brief Returns the number of node slots currently allocated in the pool.
+     * @return The capacity of the pool.
+     */
+    [[nodiscard]] unsigned long long get_capacity() const;
+    /**
+     * @brief Grows the pool so that at least the given number of elements fit without reallocation.
+     * @param new_capacity The number of slots to reserve.
+     * @throws std::length_error if new_capacity exceeds the 32-bit index range.
+     */
+    void reserve(unsigned long long new_capacity);
     /**
      * @brief Reverses the order of the elements in the list.
      */
     void reverse();
+    /**
+     * @brief Sorts the list with a stable bottom-up merge sort in O(n log n).
+     *
+     * Nodes are relinked in place: no element is copied and no memory is allocated.
+     *
+     * @tparam Compare Strict weak ordering on T.
+     * @param comp The comparator (std::less<T> by default).
+     */
+    template <class Compare = std::less<T>>
+    void sort(Compare comp = Compare());
+    /**
+     * @brief Merges another sorted list into this sorted list in O(n + m).
+     * Both lists own separate node pools, so the elements of other are moved into this
+     * list's pool; the interleaving itself is a single O(n + m) pass.
+     *
+     * The merge is stable: for equivalent elements, those of this list come first.
+     *
+     * @tparam Compare Strict weak ordering on T, the one both lists are sorted by.
+     * @param other The list to merge from. Left empty.
+     * @param comp The comparator (std::less<T> by default).
+     */
+    template <class Compare = std::less<T>>
+    void merge(Linked_List_Array& other, Compare comp = Compare());
+    /**
+     * @brief Removes all but the first element of every run of equivalent consecutive elements.
+     * @tparam BinaryPredicate Callable comparing two elements for equivalence.
+     * @param pred The predicate (std::equal_to<T> by default).
+     * @return The number of elements removed.
+     */
+    template <class BinaryPredicate = std::equal_to<T>>
+    unsigned long long unique(BinaryPredicate pred = BinaryPredicate());
     /**
      * @brief Prints the contents of the list to standard output.
      */
@@ -131,16 +241,24 @@ public:
      * @brief Forward iterator for the linked list array.
      */
     class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag; ///< Iterator category tag.
+        using value_type = T;                                ///< Element type.
+        using difference_type = std::ptrdiff_t;              ///< Distance type.
+        using pointer = T*;                                  ///< Pointer to element.
+        using reference = T&;                                ///< Reference to element.
     private:
-        node* curr; ///< Pointer to the current node.
+        std::uint32_t curr; ///< Index of the current node, or npos.
         Linked_List_Array<T>* list; ///< Pointer to the parent list.
+        bool before_front; ///< True for the position returned by before_begin().
+        friend class Linked_List_Array<T>;
     public:
         /**
          * @brief Constructs an iterator for a given node and list.
-         * @param p Pointer to the node.
+         * @param i Index of the node.
          * @param l Pointer to the parent list.
          */
-        Iterator(node* p, Linked_List_Array<T>* l);
+        Iterator(std::uint32_t i, Linked_List_Array<T>* l);
         /**
          * @brief Default constructor. Creates an end iterator.
          */
@@ -200,6 +318,61 @@ public:
      * @return Iterator to one past the last element.
      */
     Iterator end();
+    /**
+     * @brief Returns an iterator to the position before the first element.
+     *
+     * The iterator must not be dereferenced; it exists so that insert_after() and
+     * erase_after() can operate on the front of the list.
+     *
+     * @return Iterator that yields begin() when incremented.
+     */
+    Iterator before_begin();
+    /**
+     * @brief Inserts an element after the given position in O(1).
+     * @param pos Iterator to an element, or before_begin().
+     * @param new_item The element to insert.
+     * @return Iterator to the inserted element.
+     * @throws std::runtime_error if pos is end().
+     */
+    Iterator insert_after(Iterator pos, T new_item);
+    /**
+     * @brief Removes the element following the given position in O(1).
+     * @param pos Iterator to an element, or before_begin().
+     * @return Iterator to the element that followed the removed one, or end().
+     * @throws std::runtime_error if there is no element after pos.
+     */
+    Iterator erase_after(Iterator pos);
+    /**
+     * @brief Removes every element satisfying a predicate in a single pass.
+     * @tparam Predicate Callable taking a const T& and returning bool.
+     * @param pred The predicate selecting elements to remove.
+     * @return The number of elements removed.
+     */
+    template <class Predicate>
+    unsigned long long remove_if(Predicate pred);
+    /**
+     * @brief Applies a function to every element, front to back.
+     * @tparam Function Callable taking a T&.
+     * @param fn The function to apply.
+     */
+    template <class Function>
+    void for_each(Function fn);
+    /**
+     * @brief Finds the first element equal to a value.
+     * @param value The value to search for.
+     * @return Iterator to the first matching element, or end() if there is none.
+     */
+    Iterator find(const T& value);
+    /**
+     * @brief Folds every element into an accumulator, front to back.
+     * @tparam U The accumulator type.
+     * @tparam BinaryOperation Callable combining a U and a const T& into a U.
+     * @param init The initial accumulator value.
+     * @param op The folding operation (addition by default).
+     * @return The final accumulator value.
+     */
+    template <class U, class BinaryOperation = std::plus<>>
+    U accumulate(U init, BinaryOperation op = BinaryOperation());
 };
 
 #include "Linked_List_Array.tpp"
@@ -5,25 +5,41 @@
  */
 
 #include "Linked_List_Array.hpp"
+#include <cstring>
+#include <type_traits>
+#include <utility>
 
 template <class T>
-Linked_List_Array<T>::Linked_List_Array() : front(nullptr), length(0) {}
+Linked_List_Array<T>::Linked_List_Array()
+    : pool(nullptr), capacity(0), used(0), free_head(npos), front(npos), back(npos), length(0) {}
 
 template <class T>
 Linked_List_Array<T>::~Linked_List_Array() {
-    clear();
+    delete[] pool;
 }
 
 template <class T>
-Linked_List_Array<T>::Linked_List_Array(std::initializer_list<T> array) : front(nullptr), length(0) {
+Linked_List_Array<T>::Linked_List_Array(std::initializer_list<T> array)
+    : pool(nullptr), capacity(0), used(0), free_head(npos), front(npos), back(npos), length(0) {
+    reserve(array.size());
     for (const T& item : array) {
         push_back(item);
     }
 }
 
+template <class T>
+template <class InputIt, class>
+Linked_List_Array<T>::Linked_List_Array(InputIt first, InputIt last)
+    : pool(nullptr), capacity(0), used(0), free_head(npos), front(npos), back(npos), length(0) {
+    for (; first != last; ++first) {
+        push_back(*first);
+    }
+}
+
 template <class T>
 Linked_List_Array<T>& Linked_List_Array<T>::operator=(std::initializer_list<T> array) {
     clear();
+    reserve(array.size());
     for (const T& item : array) {
         push_back(item);
     }
@@ -31,27 +47,116 @@ Linked_List_Array<T>& Linked_List_Array<T>::operator=(std::initializer_list<T> a
 }
 
 template <class T>
-Linked_List_Array<T>::Linked_List_Array(const Linked_List_Array<T>& other) : front(nullptr), length(0) {
-    node* temp = other.front;
-    while (temp != nullptr) {
-        push_back(temp->item);
-        temp = temp->next;
-    }
+Linked_List_Array<T>::Linked_List_Array(const Linked_List_Array<T>& other)
+    : pool(nullptr), capacity(0), used(0), free_head(npos), front(npos), back(npos), length(0) {
+    copy_from(other);
 }
 
 template <class T>
 Linked_List_Array<T>& Linked_List_Array<T>::operator=(const Linked_List_Array<T>& other) {
     if (this != &other) {
-        clear();
-        node* temp = other.front;
-        while (temp != nullptr) {
-            push_back(temp->item);
-            temp = temp->next;
-        }
+        copy_from(other);
     }
     return *this;
 }
 
+template <class T>
+template <class InputIt, class>
+void Linked_List_Array<T>::assign(InputIt first, InputIt last) {
+    clear();
+    for (; first != last; ++first) {
+        push_back(*first);
+    }
+}
+
+template <class T>
+void Linked_List_Array<T>::copy_from(const Linked_List_Array<T>& other) {
+    if (capacity < other.used) {
+        node* new_pool = new node[other.used];
+        delete[] pool;
+        pool = new_pool;
+        capacity = other.used;
+    }
+    if constexpr (std::is_trivially_copyable<node>::value) {
+        if (other.used != 0) {
+            std::memcpy(pool, other.pool, sizeof(node) * other.used);
+        }
+    } else {
+        for (std::uint32_t i = 0; i < other.used; ++i) {
+            pool[i] = other.pool[i];
+        }
+        // Slots past the copied range are now unused; release what they still hold
+        for (std::uint32_t i = other.used; i < used; ++i) {
+            pool[i].item = T();
+        }
+    }
+    used = other.used;
+    free_head = other.free_head;
+    front = other.front;
+    back = other.back;
+    length = other.length;
+}
+
+template <class T>
+void Linked_List_Array<T>::reserve(unsigned long long new_capacity) {
+    if (new_capacity <= capacity) return;
+    if (new_capacity > npos) {
+        throw std::length_error("Capacity exceeds index range in reserve()");
+    }
+    node* new_pool = new node[new_capacity];
+    if constexpr (std::is_trivially_copyable<node>::value) {
+        if (used != 0) {
+            std::memcpy(new_pool, pool, sizeof(node) * used);
+        }
+    } else {
+        for (std::uint32_t i = 0; i < used; ++i) {
+            new_pool[i].next = pool[i].next;
+            new_pool[i].item = std::move(pool[i].item);
+        }
+    }
+    delete[] pool;
+    pool = new_pool;
+    capacity = static_cast<std::uint32_t>(new_capacity);
+}
+
+template <class T>
+void Linked_List_Array<T>::grow() {
+    if (capacity == npos) {
+        throw std::length_error("Node pool exhausted the index range");
+    }
+    unsigned long long new_capacity = (capacity == 0) ? 10 : 2ULL * capacity;
+    if (new_capacity > npos) {
+        new_capacity = npos;
+    }
+    reserve(new_capacity);
+}
+
+template <class T>
+std::uint32_t Linked_List_Array<T>::allocate_node(T new_item, std::uint32_t next) {
+    std::uint32_t index;
+    if (free_head != npos) {
+        index = free_head;
+        free_head = pool[index].next;
+    } else {
+        if (used == capacity) {
+            grow();
+        }
+        index = used++;
+    }
+    pool[index].next = next;
+    pool[index].item = std::move(new_item);
+    return index;
+}
+
+template <class T>
+void Linked_List_Array<T>::release_node(std::uint32_t index) {
+    if constexpr (!std::is_trivially_copyable<T>::value) {
+        pool[index].item = T();
+    }
+    pool[index].next = free_head;
+    free_head = index;
+}
+
 template <class T>
 unsigned long long Linked_List_Array<T>::get_length() const {
     return length;
@@ -62,25 +167,30 @@ bool Linked_List_Array<T>::empty() const {
     return length == 0;
 }
 
+template <class T>
+unsigned long long Linked_List_Array<T>::get_capacity() const {
+    return capacity;
+}
+
 template <class T>
 void Linked_List_Array<T>::push_back(T new_item) {
-    node* new_node = new node{nullptr, new_item};
+    std::uint32_t new_node = allocate_node(std::move(new_item), npos);
     if (empty()) {
-        front = new_node;
+        front = back = new_node;
     } else {
-        node* temp = front;
-        while (temp->next != nullptr) {
-            temp = temp->next;
-        }
-        temp->next = new_node;
+        pool[back].next = new_node;
+        back = new_node;
     }
     ++length;
 }
 
 template <class T>
 void Linked_List_Array<T>::push_front(T new_item) {
-    node* new_node = new node{front, new_item};
+    std::uint32_t new_node = allocate_node(std::move(new_item), front);
     front = new_node;
+    if (back == npos) {
+        back = new_node;
+    }
     ++length;
 }
 
@@ -90,16 +200,16 @@ void Linked_List_Array<T>::insert(const unsigned long long index, T new_item) {
         throw std::out_of_range("Index out of range in insert()");
     }
     if (index == 0) {
-        push_front(new_item);
+        push_front(std::move(new_item));
     } else if (index == length) {
-        push_back(new_item);
+        push_back(std::move(new_item));
     } else {
-        node* temp = front;
+        std::uint32_t temp = front;
         for (unsigned long long i = 0; i < index - 1; ++i) {
-            temp = temp->next;
+            temp = pool[temp].next;
         }
-        node* new_node = new node{temp->next, new_item};
-        temp->next = new_node;
+        std::uint32_t new_node = allocate_node(std::move(new_item), pool[temp].next);
+        pool[temp].next = new_node;
         ++length;
     }
 }
@@ -108,15 +218,16 @@ template <class T>
 void Linked_List_Array<T>::pop_back() {
     if (empty()) return;
     if (length == 1) {
-        delete front;
-        front = nullptr;
+        release_node(front);
+        front = back = npos;
     } else {
-        node* temp = front;
-        while (temp->next->next != nullptr) {
-            temp = temp->next;
+        std::uint32_t temp = front;
+        while (pool[temp].next != back) {
+            temp = pool[temp].next;
         }
-        delete temp->next;
-        temp->next = nullptr;
+        release_node(back);
+        pool[temp].next = npos;
+        back = temp;
     }
     --length;
 }
@@ -124,10 +235,13 @@ void Linked_List_Array<T>::pop_back() {
 template <class T>
 void Linked_List_Array<T>::pop_front() {
     if (empty()) return;
-    node* temp = front;
-    front = front->next;
-    delete temp;
+    std::uint32_t temp = front;
+    front = pool[front].next;
+    release_node(temp);
     --length;
+    if (empty()) {
+        back = npos;
+    }
 }
 
 template <class T>
@@ -140,45 +254,52 @@ void Linked_List_Array<T>::erase(unsigned long long index) {
     } else if (index == length - 1) {
         pop_back();
     } else {
-        node* temp = front;
+        std::uint32_t temp = front;
         for (unsigned long long i = 0; i < index - 1; ++i) {
-            temp = temp->next;
+            temp = pool[temp].next;
         }
-        node* del = temp->next;
-        temp->next = del->next;
-        delete del;
+        std::uint32_t del = pool[temp].next;
+        pool[temp].next = pool[del].next;
+        release_node(del);
         --length;
     }
 }
 
 template <class T>
 void Linked_List_Array<T>::clear() {
-    while (!empty()) {
-        pop_front();
+    if constexpr (!std::is_trivially_copyable<T>::value) {
+        // Release what the elements hold now; free slots were already reset by release_node()
+        for (std::uint32_t index = front; index != npos; index = pool[index].next) {
+            pool[index].item = T();
+        }
     }
+    used = 0;
+    free_head = npos;
+    front = back = npos;
+    length = 0;
 }
 
 template <class T>
 void Linked_List_Array<T>::reverse() {
-    node* prev = nullptr;
-    node* current = front;
-    node* next = nullptr;
-    while (current != nullptr) {
-        next = current->next;
-        current->next = prev;
+    std::uint32_t prev = npos;
+    std::uint32_t current = front;
+    while (current != npos) {
+        std::uint32_t next = pool[current].next;
+        pool[current].next = prev;
         prev = current;
         current = next;
     }
+    back = front;
     front = prev;
 }
 
 template <class T>
 void Linked_List_Array<T>::print() const {
-    node* temp = front;
+    std::uint32_t temp = front;
     std::cout << "[ ";
-    while (temp != nullptr) {
-        std::cout << temp->item << ' ';
-        temp = temp->next;
+    while (temp != npos) {
+        std::cout << pool[temp].item << ' ';
+        temp = pool[temp].next;
     }
     std::cout << ']' << std::endl;
 }
@@ -188,11 +309,14 @@ T& Linked_List_Array<T>::operator[](const long long index) {
     if (index < 0 || static_cast<unsigned long long>(index) >= length) {
         throw std::out_of_range("Index out of range in operator[]");
     }
-    node* temp = front;
-    for (unsigned long long i = 0; i < index; ++i) {
-        temp = temp->next;
+    if (static_cast<unsigned long long>(index) == length - 1) {
+        return pool[back].item;
+    }
+    std::uint32_t temp = front;
+    for (long long i = 0; i < index; ++i) {
+        temp = pool[temp].next;
     }
-    return temp->item;
+    return pool[temp].item;
 }
 
 template <class T>
@@ -201,4 +325,292 @@ T& Linked_List_Array<T>::at(const long long index) {
         throw std::out_of_range("Index out of range in at()");
     }
     return operator[](index);
-} 
\ No newline at end of file
+}
+
+template <class T>
+Linked_List_Array<T>::Iterator::Iterator(std::uint32_t i, Linked_List_Array<T>* l) : curr(i), list(l), before_front(false) {}
+
+template <class T>
+Linked_List_Array<T>::Iterator::Iterator() : curr(npos), list(nullptr), before_front(false) {}
+
+template <class T>
+Linked_List_Array<T>::Iterator::Iterator(const Iterator& other) : curr(other.curr), list(other.list), before_front(other.before_front) {}
+
+template <class T>
+typename Linked_List_Array<T>::Iterator& Linked_List_Array<T>::Iterator::operator=(const Iterator& other) {
+    if (this != &other) {
+        curr = other.curr;
+        list = other.list;
+        before_front = other.before_front;
+    }
+    return *this;
+}
+
+template <class T>
+bool Linked_List_Array<T>::Iterator::operator==(const Iterator& other) const {
+    return curr == other.curr && before_front == other.before_front;
+}
+
+template <class T>
+bool Linked_List_Array<T>::Iterator::operator!=(const Iterator& other) const {
+    return !(*this == other);
+}
+
+template <class T>
+T& Linked_List_Array<T>::Iterator::operator*() {
+    if (curr == npos || before_front) {
+        throw std::runtime_error("Dereferencing a null iterator.");
+    }
+    return list->pool[curr].item;
+}
+
+template <class T>
+typename Linked_List_Array<T>::Iterator& Linked_List_Array<T>::Iterator::operator++() {
+    if (before_front) {
+        curr = list->front;
+        before_front = false;
+    } else if (curr != npos) {
+        curr = list->pool[curr].next;
+    }
+    return *this;
+}
+
+template <class T>
+typename Linked_List_Array<T>::Iterator Linked_List_Array<T>::Iterator::operator++(int) {
+    Iterator temp = *this;
+    ++(*this);
+    return temp;
+}
+
+template <class T>
+T* Linked_List_Array<T>::Iterator::operator->() {
+    if (curr == npos || before_front) {
+        throw std::runtime_error("Cannot access member via end() iterator");
+    }
+    return &(list->pool[curr].item);
+}
+
+template <class T>
+typename Linked_List_Array<T>::Iterator Linked_List_Array<T>::begin() {
+    return Iterator(front, this);
+}
+
+template <class T>
+typename Linked_List_Array<T>::Iterator Linked_List_Array<T>::end() {
+    return Iterator(npos, this);
+}
+
+template <class T>
+typename Linked_List_Array<T>::Iterator Linked_List_Array<T>::before_begin() {
+    Iterator it(npos, this);
+    it.before_front = true;
+    return it;
+}
+
+template <class T>
+typename Linked_List_Array<T>::Iterator Linked_List_Array<T>::insert_after(Iterator pos, T new_item) {
+    if (pos.before_front) {
+        push_front(std::move(new_item));
+        return begin();
+    }
+    if (pos.curr == npos) {
+        throw std::runtime_error("Cannot insert after end() iterator");
+    }
+    std::uint32_t new_node = allocate_node(std::move(new_item), pool[pos.curr].next);
+    pool[pos.curr].next = new_node;
+    if (pos.curr == back) {
+        back = new_node;
+    }
+    ++length;
+    return Iterator(new_node, this);
+}
+
+template <class T>
+typename Linked_List_Array<T>::Iterator Linked_List_Array<T>::erase_after(Iterator pos) {
+    if (pos.before_front) {
+        if (empty()) {
+            throw std::runtime_error("No element to erase after iterator");
+        }
+        pop_front();
+        return begin();
+    }
+    if (pos.curr == npos || pool[pos.curr].next == npos) {
+        throw std::runtime_error("No element to erase after iterator");
+    }
+    std::uint32_t del = pool[pos.curr].next;
+    pool[pos.curr].next = pool[del].next;
+    if (del == back) {
+        back = pos.curr;
+    }
+    release_node(del);
+    --length;
+    return Iterator(pool[pos.curr].next, this);
+}
+
+template <class T>
+template <class Predicate>
+unsigned long long Linked_List_Array<T>::remove_if(Predicate pred) {
+    unsigned long long removed = 0;
+    std::uint32_t prev = npos;
+    std::uint32_t current = front;
+    while (current != npos) {
+        std::uint32_t next = pool[current].next;
+        if (pred(static_cast<const T&>(pool[current].item))) {
+            if (prev == npos) {
+                front = next;
+            } else {
+                pool[prev].next = next;
+            }
+            release_node(current);
+            ++removed;
+        } else {
+            prev = current;
+        }
+        current = next;
+    }
+    back = prev;
+    length -= removed;
+    return removed;
+}
+
+template <class T>
+template <class Compare>
+std::uint32_t Linked_List_Array<T>::merge_chains(std::uint32_t a, std::uint32_t b, Compare& comp) {
+    std::uint32_t head = npos;
+    std::uint32_t tail = npos;
+    while (a != npos && b != npos) {
+        std::uint32_t taken;
+        if (comp(pool[b].item, pool[a].item)) {
+            taken = b;
+            b = pool[b].next;
+        } else {
+            taken = a;
+            a = pool[a].next;
+        }
+        if (tail == npos) {
+            head = taken;
+        } else {
+            pool[tail].next = taken;
+        }
+        tail = taken;
+    }
+    const std::uint32_t rest = (a != npos) ? a : b;
+    if (tail == npos) {
+        return rest;
+    }
+    pool[tail].next = rest;
+    return head;
+}
+
+template <class T>
+template <class Compare>
+void Linked_List_Array<T>::sort(Compare comp) {
+    if (length < 2) return;
+
+    // bins[i] holds a sorted run of 2^i nodes; earlier runs sit in higher bins
+    std::uint32_t bins[33];
+    for (std::uint32_t& bin : bins) {
+        bin = npos;
+    }
+    std::uint32_t rest = front;
+    while (rest != npos) {
+        std::uint32_t run = rest;
+        rest = pool[rest].next;
+        pool[run].next = npos;
+        int i = 0;
+        for (; bins[i] != npos; ++i) {
+            run = merge_chains(bins[i], run, comp);
+            bins[i] = npos;
+        }
+        bins[i] = run;
+    }
+
+    std::uint32_t result = npos;
+    for (std::uint32_t bin : bins) {
+        if (bin != npos) {
+            result = (result == npos) ? bin : merge_chains(bin, result, comp);
+        }
+    }
+
+    front = result;
+    back = result;
+    while (pool[back].next != npos) {
+        back = pool[back].next;
+    }
+}
+
+template <class T>
+template <class Compare>
+void Linked_List_Array<T>::merge(Linked_List_Array<T>& other, Compare comp) {
+    if (this == &other || other.empty()) return;
+    reserve(static_cast<unsigned long long>(used) + other.length);
+
+    // Walk this list once, moving each element of other in front of the first greater one
+    std::uint32_t prev = npos;
+    std::uint32_t current = front;
+    for (std::uint32_t source = other.front; source != npos; source = other.pool[source].next) {
+        T& item = other.pool[source].item;
+        while (current != npos && !comp(item, pool[current].item)) {
+            prev = current;
+            current = pool[current].next;
+        }
+        std::uint32_t new_node = allocate_node(std::move(item), current);
+        if (prev == npos) {
+            front = new_node;
+        } else {
+            pool[prev].next = new_node;
+        }
+        if (current == npos) {
+            back = new_node;
+        }
+        prev = new_node;
+    }
+    length += other.length;
+    other.clear();
+}
+
+template <class T>
+template <class BinaryPredicate>
+unsigned long long Linked_List_Array<T>::unique(BinaryPredicate pred) {
+    unsigned long long removed = 0;
+    if (empty()) return removed;
+    std::uint32_t kept = front;
+    while (pool[kept].next != npos) {
+        std::uint32_t candidate = pool[kept].next;
+        if (pred(pool[kept].item, pool[candidate].item)) {
+            pool[kept].next = pool[candidate].next;
+            release_node(candidate);
+            ++removed;
+        } else {
+            kept = candidate;
+        }
+    }
+    back = kept;
+    length -= removed;
+    return removed;
+}
+
+template <class T>
+template <class Function>
+void Linked_List_Array<T>::for_each(Function fn) {
+    for (std::uint32_t curr = front; curr != npos; curr = pool[curr].next) {
+        fn(pool[curr].item);
+    }
+}
+
+template <class T>
+typename Linked_List_Array<T>::Iterator Linked_List_Array<T>::find(const T& value) {
+    for (std::uint32_t curr = front; curr != npos; curr = pool[curr].next) {
+        if (pool[curr].item == value) {
+            return Iterator(curr, this);
+        }
+    }
+    return end();
+}
+
+template <class T>
+template <class U, class BinaryOperation>
+U Linked_List_Array<T>::accumulate(U init, BinaryOperation op) {
+    for_each([&init, &op](const T& item) { init = op(std::move(init), item); });
+    return init;
+}
@@ -0,0 +1,282 @@
+/**
+ * @file Skip_List.h
+ * @brief Declaration of an indexable skip list supporting O(log n) positional access.
+ */
+
+#ifndef SKIP_LIST_H
+#define SKIP_LIST_H
+
+#include <iostream>
+#include <initializer_list>
+#include <stdexcept>
+#include <iterator>
+#include <random>
+
+/**
+ * @class Skip_List
+ * @brief A generic positional sequence stored as an indexable skip list.
+ *
+ * Elements keep their insertion order (the list is not sorted). Every forward link stores
+ * its span width, i.e. how many elements it skips, so operator[], insert(index) and
+ * erase(index) run in expected O(log n). The bottom level is doubly linked for
+ * bidirectional iteration.
+ *
+ * The level probability trades memory for speed: each node carries on average
+ * 1 / (1 - p) links, and searches take about log(n) / log(1 / p) levels.
+ *
+ * @tparam T The type of elements stored in the list.
+ */
+template <class T>
+class Skip_List {
+private:
+    struct node;
+
+    /**
+     * @struct link
+     * @brief A forward pointer on one level together with the number of elements it spans.
+     */
+    struct link {
+        node* next;               ///< Next node on this level, or nullptr.
+        unsigned long long width; ///< Number of bottom-level steps to next (unused if next is nullptr).
+    };
+
+    /**
+     * @struct node
+     * @brief Internal node structure for the skip list.
+     */
+    struct node {
+        link* links; ///< Array of forward links, one per level.
+        node* prev;  ///< Pointer to the previous node on the bottom level.
+        int level;   ///< Number of levels this node participates in.
+        T item;      ///< The data stored in the node.
+    };
+
+    static constexpr int MAX_LEVEL = 32; ///< Maximum number of levels.
+
+    link head[MAX_LEVEL]; ///< Forward links of the head sentinel.
+    node* back;           ///< Pointer to the last node in the list.
+    int level;            ///< Number of levels currently in use.
+    double probability;   ///< Probability of promoting a node to the next level.
+    unsigned long long length; ///< Number of elements in the list.
+    std::minstd_rand rng; ///< Random generator used to pick node levels.
+
+    /**
+     * @brief Draws a random level for a new node.
+     * @return A level between 1 and MAX_LEVEL.
+     */
+    int random_level();
+    /**
+     * @brief Returns the forward links of a node, or of the head sentinel for nullptr.
+     * @param ptr The node, or nullptr for the head.
+     * @return Pointer to the link array.
+     */
+    link* links_of(node* ptr);
+    /**
+     * @brief Finds, on every level, the last node positioned before an index.
+     * @param index The index being searched for.
+     * @param update Output: predecessor on each level (nullptr for the head).
+     * @param update_pos Output: position of each predecessor (head = 0, element i = i + 1).
+     */
+    void find_predecessors(unsigned long long index, node** update, unsigned long long* update_pos);
+    /**
+     * @brief Resets the list to the empty state without freeing nodes.
+     */
+    void reset();
+
+public:
+    /**
+     * @brief Default constructor. Initializes an empty list.
+     * @param p Probability of promoting a node to the next level, in (0, 1).
+     * @throws std::invalid_argument if p is not in (0, 1).
+     */
+    explicit Skip_List(double p = 0.5);
+    /**
+     * @brief Destructor. Clears the list and frees memory.
+     */
+    ~Skip_List();
+    /**
+     * @brief Constructs a list from an initializer list.
+     * @param array The initializer list of elements.
+     */
+    Skip_List(std::initializer_list<T> array);
+    /**
+     * @brief Assigns an initializer list to the list.
+     * @param array The initializer list of elements.
+     * @return Reference to this list.
+     */
+    Skip_List& operator=(std::initializer_list<T> array);
+    /**
+     * @brief Copy constructor.
+     * @param other The list to copy from.
+     */
+    Skip_List(const Skip_List& other);
+    /**
+     * @brief Copy assignment operator.
+     * @param other The list to copy from.
+     * @return Reference to this list.
+     */
+    Skip_List& operator=(const Skip_List& other);
+    /**
+     * @brief Returns the number of elements in the list.
+     * @return The length of the list.
+     */
+    [[nodiscard]] unsigned long long get_length() const;
+    /**
+     * @brief Checks if the list is empty.
+     * @return True if the list is empty, false otherwise.
+     */
+    [[nodiscard]] bool empty() const;
+    /**
+     * @brief Returns the level promotion probability.
+     * @return The probability used when choosing node levels.
+     */
+    [[nodiscard]] double get_probability() const;
+    /**
+     * @brief Adds an element to the end of the list.
+     * @param new_item The element to add.
+     */
+    void push_back(T new_item);
+    /**
+     * @brief Adds an element to the front of the list.
+     * @param new_item The element to add.
+     */
+    void push_front(T new_item);
+    /**
+     * @brief Inserts an element at a specific index in expected O(log n).
+     * @param index The position to insert at.
+     * @param new_item The element to insert.
+     * @throws std::out_of_range if the index is greater than the length.
+     */
+    void insert(const unsigned long long index, T new_item);
+    /**
+     * @brief Removes the last element from the list.
+     */
+    void pop_back();
+    /**
+     * @brief Removes the first element from the list.
+     */
+    void pop_front();
+    /**
+     * @brief Removes the element at a specific index in expected O(log n).
+     * @param index The position of the element to remove.
+     * @throws std::out_of_range if the index is invalid.
+     */
+    void erase(unsigned long long index);
+    /**
+     * @brief Removes all elements from the list.
+     */
+    void clear();
+    /**
+     * @brief Prints the contents of the list to standard output.
+     */
+    void print() const;
+    /**
+     * @brief Provides random access to elements by index in expected O(log n).
+     * @param index The index of the element.
+     * @return Reference to the element at the given index.
+     * @throws std::out_of_range if the index is invalid.
+     */
+    T& operator[](const long long index);
+    /**
+     * @brief Provides checked access to elements by index.
+     * @param index The index of the element.
+     * @return Reference to the element at the given index.
+     * @throws std::out_of_range if the index is invalid.
+     */
+    T& at(const long long index);
+
+    /**
+     * @class Iterator
+     * @brief Bidirectional iterator over the bottom level of the skip list.
+     */
+    class Iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag; ///< Iterator category tag.
+        using value_type = T;                                      ///< Element type.
+        using difference_type = std::ptrdiff_t;                    ///< Distance type.
+        using pointer = T*;                                        ///< Pointer to element.
+        using reference = T&;                                      ///< Reference to element.
+    private:
+        node* curr; ///< Pointer to the current node.
+        Skip_List<T>* list; ///< Pointer to the parent list.
+    public:
+        /**
+         * @brief Constructs an iterator for a given node and list.
+         * @param p Pointer to the node.
+         * @param l Pointer to the parent list.
+         */
+        Iterator(node* p, Skip_List<T>* l);
+        /**
+         * @brief Default constructor. Creates an end iterator.
+         */
+        Iterator();
+        /**
+         * @brief Copy constructor.
+         * @param other The iterator to copy from.
+         */
+        Iterator(const Iterator& other);
+        /**
+         * @brief Assignment operator.
+         * @param other The iterator to assign from.
+         * @return Reference to this iterator.
+         */
+        Iterator& operator=(const Iterator& other);
+        /**
+         * @brief Checks if two iterators are equal.
+         * @param other The iterator to compare with.
+         * @return True if equal, false otherwise.
+         */
+        bool operator==(const Iterator& other) const;
+        /**
+         * @brief Checks if two iterators are not equal.
+         * @param other The iterator to compare with.
+         * @return True if not equal, false otherwise.
+         */
+        bool operator!=(const Iterator& other) const;
+        /**
+         * @brief Dereferences the iterator to access the element.
+         * @return Reference to the element.
+         */
+        T& operator*();
+        /**
+         * @brief Advances the iterator to the next element (prefix).
+         * @return Reference to this iterator.
+         */
+        Iterator& operator++();
+        /**
+         * @brief Advances the iterator to the next element (postfix).
+         * @return Iterator before increment.
+         */
+        Iterator operator++(int);
+        /**
+         * @brief Moves the iterator to the previous element (prefix).
+         * @return Reference to this iterator.
+         */
+        Iterator& operator--();
+        /**
+         * @brief Moves the iterator to the previous element (postfix).
+         * @return Iterator before decrement.
+         */
+        Iterator operator--(int);
+        /**
+         * @brief Accesses the element pointer.
+         * @return Pointer to the element.
+         */
+        T* operator->();
+    };
+
+    /**
+     * @brief Returns an iterator to the beginning of the list.
+     * @return Iterator to the first element.
+     */
+    Iterator begin();
+    /**
+     * @brief Returns an iterator to the end of the list.
+     * @return Iterator to one past the last element.
+     */
+    Iterator end();
+};
+
+#include "Skip_List.tpp"
+
+#endif // SKIP_LIST_H
@@ -0,0 +1,354 @@
+/**
+ * @file Skip_List.tpp
+ * @brief Implementation file for the Skip_List template class.
+ * @see Skip_List.h for class documentation.
+ */
+
+#include "Skip_List.hpp"
+
+template <class T>
+Skip_List<T>::Skip_List(double p) : back(nullptr), level(1), probability(p), length(0) {
+    if (!(p > 0.0 && p < 1.0)) {
+        throw std::invalid_argument("Level probability must be in (0, 1)");
+    }
+    reset();
+}
+
+template <class T>
+Skip_List<T>::~Skip_List() {
+    clear();
+}
+
+template <class T>
+Skip_List<T>::Skip_List(std::initializer_list<T> array) : Skip_List() {
+    for (const T& item : array) {
+        push_back(item);
+    }
+}
+
+template <class T>
+Skip_List<T>& Skip_List<T>::operator=(std::initializer_list<T> array) {
+    clear();
+    for (const T& item : array) {
+        push_back(item);
+    }
+    return *this;
+}
+
+template <class T>
+Skip_List<T>::Skip_List(const Skip_List& other) : Skip_List(other.probability) {
+    for (node* temp = other.head[0].next; temp != nullptr; temp = temp->links[0].next) {
+        push_back(temp->item);
+    }
+}
+
+template <class T>
+Skip_List<T>& Skip_List<T>::operator=(const Skip_List& other) {
+    if (this != &other) {
+        clear();
+        probability = other.probability;
+        for (node* temp = other.head[0].next; temp != nullptr; temp = temp->links[0].next) {
+            push_back(temp->item);
+        }
+    }
+    return *this;
+}
+
+template <class T>
+unsigned long long Skip_List<T>::get_length() const {
+    return length;
+}
+
+template <class T>
+bool Skip_List<T>::empty() const {
+    return length == 0;
+}
+
+template <class T>
+double Skip_List<T>::get_probability() const {
+    return probability;
+}
+
+template <class T>
+void Skip_List<T>::reset() {
+    for (int i = 0; i < MAX_LEVEL; ++i) {
+        head[i].next = nullptr;
+        head[i].width = 0;
+    }
+    back = nullptr;
+    level = 1;
+    length = 0;
+}
+
+template <class T>
+int Skip_List<T>::random_level() {
+    std::uniform_real_distribution<double> coin(0.0, 1.0);
+    int new_level = 1;
+    while (new_level < MAX_LEVEL && coin(rng) < probability) {
+        ++new_level;
+    }
+    return new_level;
+}
+
+template <class T>
+typename Skip_List<T>::link* Skip_List<T>::links_of(node* ptr) {
+    return (ptr == nullptr) ? head : ptr->links;
+}
+
+template <class T>
+void Skip_List<T>::find_predecessors(unsigned long long index, node** update, unsigned long long* update_pos) {
+    node* curr = nullptr;
+    unsigned long long pos = 0;
+    for (int i = level - 1; i >= 0; --i) {
+        link* links = links_of(curr);
+        while (links[i].next != nullptr && pos + links[i].width <= index) {
+            pos += links[i].width;
+            curr = links[i].next;
+            links = curr->links;
+        }
+        update[i] = curr;
+        update_pos[i] = pos;
+    }
+}
+
+template <class T>
+void Skip_List<T>::push_back(T new_item) {
+    insert(length, new_item);
+}
+
+template <class T>
+void Skip_List<T>::push_front(T new_item) {
+    insert(0, new_item);
+}
+
+template <class T>
+void Skip_List<T>::insert(const unsigned long long index, T new_item) {
+    if (index > length) {
+        throw std::out_of_range("Index out of range in insert()");
+    }
+
+    node* update[MAX_LEVEL];
+    unsigned long long update_pos[MAX_LEVEL];
+    find_predecessors(index, update, update_pos);
+
+    const int new_level = random_level();
+    for (int i = level; i < new_level; ++i) {
+        update[i] = nullptr;
+        update_pos[i] = 0;
+    }
+    if (new_level > level) {
+        level = new_level;
+    }
+
+    node* new_node = new node{new link[new_level], update[0], new_level, new_item};
+    const unsigned long long new_pos = index + 1;
+    for (int i = 0; i < level; ++i) {
+        link& before = links_of(update[i])[i];
+        if (i < new_level) {
+            new_node->links[i].next = before.next;
+            new_node->links[i].width = (before.next != nullptr) ? update_pos[i] + before.width + 1 - new_pos : 0;
+            before.next = new_node;
+            before.width = new_pos - update_pos[i];
+        } else if (before.next != nullptr) {
+            ++before.width;
+        }
+    }
+
+    if (new_node->links[0].next != nullptr) {
+        new_node->links[0].next->prev = new_node;
+    } else {
+        back = new_node;
+    }
+    ++length;
+}
+
+template <class T>
+void Skip_List<T>::pop_back() {
+    if (empty()) return;
+    erase(length - 1);
+}
+
+template <class T>
+void Skip_List<T>::pop_front() {
+    if (empty()) return;
+    erase(0);
+}
+
+template <class T>
+void Skip_List<T>::erase(unsigned long long index) {
+    if (index >= length) {
+        throw std::out_of_range("Index out of range in erase()");
+    }
+
+    node* update[MAX_LEVEL];
+    unsigned long long update_pos[MAX_LEVEL];
+    find_predecessors(index, update, update_pos);
+
+    node* del = links_of(update[0])[0].next;
+    for (int i = 0; i < level; ++i) {
+        link& before = links_of(update[i])[i];
+        if (i < del->level) {
+            before.next = del->links[i].next;
+            before.width = (before.next != nullptr) ? before.width + del->links[i].width - 1 : 0;
+        } else if (before.next != nullptr) {
+            --before.width;
+        }
+    }
+
+    if (del->links[0].next != nullptr) {
+        del->links[0].next->prev = del->prev;
+    } else {
+        back = del->prev;
+    }
+    while (level > 1 && head[level - 1].next == nullptr) {
+        --level;
+    }
+
+    delete[] del->links;
+    delete del;
+    --length;
+}
+
+template <class T>
+void Skip_List<T>::clear() {
+    node* current = head[0].next;
+    while (current != nullptr) {
+        node* next_node = current->links[0].next;
+        delete[] current->links;
+        delete current;
+        current = next_node;
+    }
+    reset();
+}
+
+template <class T>
+void Skip_List<T>::print() const {
+    node* temp = head[0].next;
+    std::cout << "[ ";
+    while (temp != nullptr) {
+        std::cout << temp->item << ' ';
+        temp = temp->links[0].next;
+    }
+    std::cout << ']' << std::endl;
+}
+
+template <class T>
+T& Skip_List<T>::operator[](const long long index) {
+    if (index < 0 || static_cast<unsigned long long>(index) >= length) {
+        throw std::out_of_range("Index out of range in operator[]");
+    }
+    if (static_cast<unsigned long long>(index) == length - 1) {
+        return back->item;
+    }
+    const unsigned long long target = static_cast<unsigned long long>(index) + 1;
+    node* curr = nullptr;
+    unsigned long long pos = 0;
+    for (int i = level - 1; i >= 0; --i) {
+        link* links = links_of(curr);
+        while (links[i].next != nullptr && pos + links[i].width <= target) {
+            pos += links[i].width;
+            curr = links[i].next;
+            links = curr->links;
+        }
+        if (pos == target) {
+            break;
+        }
+    }
+    return curr->item;
+}
+
+template <class T>
+T& Skip_List<T>::at(const long long index) {
+    if (index < 0 || static_cast<unsigned long long>(index) >= length) {
+        throw std::out_of_range("Index out of range in at()");
+    }
+    return operator[](index);
+}
+
+template <class T>
+Skip_List<T>::Iterator::Iterator(node* p, Skip_List<T>* l) : curr(p), list(l) {}
+
+template <class T>
+Skip_List<T>::Iterator::Iterator() : curr(nullptr), list(nullptr) {}
+
+template <class T>
+Skip_List<T>::Iterator::Iterator(const Iterator& other) : curr(other.curr), list(other.list) {}
+
+template <class T>
+typename Skip_List<T>::Iterator& Skip_List<T>::Iterator::operator=(const Iterator& other) {
+    if (this != &other) {
+        curr = other.curr;
+        list = other.list;
+    }
+    return *this;
+}
+
+template <class T>
+bool Skip_List<T>::Iterator::operator==(const Iterator& other) const {
+    return curr == other.curr;
+}
+
+template <class T>
+bool Skip_List<T>::Iterator::operator!=(const Iterator& other) const {
+    return curr != other.curr;
+}
+
+template <class T>
+T& Skip_List<T>::Iterator::operator*() {
+    if (curr) {
+        return curr->item;
+    }
+    throw std::runtime_error("Dereferencing a null iterator.");
+}
+
+template <class T>
+typename Skip_List<T>::Iterator& Skip_List<T>::Iterator::operator++() {
+    if (curr) {
+        curr = curr->links[0].next;
+    }
+    return *this;
+}
+
+template <class T>
+typename Skip_List<T>::Iterator Skip_List<T>::Iterator::operator++(int) {
+    Iterator temp = *this;
+    ++(*this);
+    return temp;
+}
+
+template <class T>
+typename Skip_List<T>::Iterator& Skip_List<T>::Iterator::operator--() {
+    if (!curr) {
+        if (list && !list->empty()) {
+            curr = list->back;
+        }
+        return *this;
+    }
+    curr = curr->prev;
+    return *this;
+}
+
+template <class T>
+typename Skip_List<T>::Iterator Skip_List<T>::Iterator::operator--(int) {
+    Iterator temp = *this;
+    --(*this);
+    return temp;
+}
+
+template <class T>
+T* Skip_List<T>::Iterator::operator->() {
+    if (!curr) {
+        throw std::runtime_error("Cannot access member via end() iterator");
+    }
+    return &(curr->item);
+}
+
+template <class T>
+typename Skip_List<T>::Iterator Skip_List<T>::begin() {
+    return Iterator(head[0].next, this);
+}
+
+template <class T>
+typename Skip_List<T>::Iterator Skip_List<T>::end() {
+    return Iterator(nullptr, this);
+}
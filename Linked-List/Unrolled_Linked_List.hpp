@@ -0,0 +1,265 @@
+/**
+ * @file Unrolled_Linked_List.h
+ * @brief Declaration of a generic unrolled linked list whose nodes hold small arrays of elements.
+ */
+
+#ifndef UNROLLED_LINKED_LIST_H
+#define UNROLLED_LINKED_LIST_H
+
+#include <iostream>
+#include <initializer_list>
+#include <stdexcept>
+#include <iterator>
+
+/**
+ * @class Unrolled_Linked_List
+ * @brief A generic doubly linked list of fixed-capacity element blocks.
+ *
+ * Each node stores up to N elements contiguously, so links and allocations are amortized
+ * over many elements and a scan touches consecutive memory. A full node is split in half
+ * on insertion; a node that drops below half capacity on erasure borrows from or merges
+ * with its successor, which keeps every node except the last at least half full.
+ *
+ * @tparam T The type of elements stored in the list. Must be default constructible.
+ * @tparam N The number of elements each node can hold (at least 2).
+ */
+template <class T, unsigned int N = 32>
+class Unrolled_Linked_List {
+    static_assert(N >= 2, "Unrolled_Linked_List needs at least two elements per node");
+
+private:
+    /**
+     * @struct node
+     * @brief Internal node structure holding a block of elements.
+     */
+    struct node {
+        node* next;         ///< Pointer to the next node.
+        node* prev;         ///< Pointer to the previous node.
+        unsigned int count; ///< Number of elements stored in this node.
+        T items[N];         ///< The elements stored in this node.
+    };
+    node* front; ///< Pointer to the first node in the list.
+    node* back;  ///< Pointer to the last node in the list.
+    unsigned long long length; ///< Number of elements in the list.
+
+    /**
+     * @brief Finds the node holding an index, walking from the nearer end.
+     * @param index The index of the element. Must be less than the length.
+     * @param offset Output: position of the element inside the returned node.
+     * @return Pointer to the node holding the element.
+     */
+    node* locate(unsigned long long index, unsigned int& offset) const;
+    /**
+     * @brief Allocates an empty node and links it after the given node.
+     * @param pos The node to link after, or nullptr to link at the front.
+     * @return Pointer to the new node.
+     */
+    node* link_after(node* pos);
+    /**
+     * @brief Unlinks and frees a node.
+     * @param old_node The node to remove.
+     */
+    void unlink(node* old_node);
+    /**
+     * @brief Moves the upper half of a full node into a new node linked after it.
+     * @param full The node to split.
+     */
+    void split(node* full);
+    /**
+     * @brief Restores the half-full invariant of a node after an erasure.
+     * @param ptr The node that lost an element.
+     */
+    void rebalance(node* ptr);
+
+public:
+    /**
+     * @brief Default constructor. Initializes an empty list.
+     */
+    Unrolled_Linked_List();
+    /**
+     * @brief Destructor. Clears the list and frees memory.
+     */
+    ~Unrolled_Linked_List();
+    /**
+     * @brief Constructs a list from an initializer list.
+     * @param array The initializer list of elements.
+     */
+    Unrolled_Linked_List(std::initializer_list<T> array);
+    /**
+     * @brief Assigns an initializer list to the list.
+     * @param array The initializer list of elements.
+     * @return Reference to this list.
+     */
+    Unrolled_Linked_List& operator=(std::initializer_list<T> array);
+    /**
+     * @brief Copy constructor. Copies block by block.
+     * @param other The list to copy from.
+     */
+    Unrolled_Linked_List(const Unrolled_Linked_List& other);
+    /**
+     * @brief Copy assignment operator.
+     * @param other The list to copy from.
+     * @return Reference to this list.
+     */
+    Unrolled_Linked_List& operator=(const Unrolled_Linked_List& other);
+    /**
+     * @brief Returns the number of elements in the list.
+     * @return The length of the list.
+     */
+    [[nodiscard]] unsigned long long get_length() const;
+    /**
+     * @brief Checks if the list is empty.
+     * @return True if the list is empty, false otherwise.
+     */
+    [[nodiscard]] bool empty() const;
+    /**
+     * @brief Adds an element to the end of the list.
+     * @param new_item The element to add.
+     */
+    void push_back(T new_item);
+    /**
+     * @brief Adds an element to the front of the list.
+     * @param new_item The element to add.
+     */
+    void push_front(T new_item);
+    /**
+     * @brief Inserts an element at a specific index.
+     * @param index The position to insert at.
+     * @param new_item The element to insert.
+     * @throws std::out_of_range if the index is greater than the length.
+     */
+    void insert(const unsigned long long index, T new_item);
+    /**
+     * @brief Removes the last element from the list.
+     */
+    void pop_back();
+    /**
+     * @brief Removes the first element from the list.
+     */
+    void pop_front();
+    /**
+     * @brief Removes the element at a specific index.
+     * @param index The position of the element to remove.
+     * @throws std::out_of_range if the index is invalid.
+     */
+    void erase(unsigned long long index);
+    /**
+     * @brief Removes all elements from the list.
+     */
+    void clear();
+    /**
+     * @brief Prints the contents of the list to standard output.
+     */
+    void print() const;
+    /**
+     * @brief Provides random access to elements by index, skipping whole nodes.
+     * @param index The index of the element.
+     * @return Reference to the element at the given index.
+     * @throws std::out_of_range if the index is invalid.
+     */
+    T& operator[](const long long index);
+    /**
+     * @brief Provides checked access to elements by index.
+     * @param index The index of the element.
+     * @return Reference to the element at the given index.
+     * @throws std::out_of_range if the index is invalid.
+     */
+    T& at(const long long index);
+
+    /**
+     * @class Iterator
+     * @brief Bidirectional iterator for the unrolled linked list.
+     */
+    class Iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag; ///< Iterator category tag.
+        using value_type = T;                                      ///< Element type.
+        using difference_type = std::ptrdiff_t;                    ///< Distance type.
+        using pointer = T*;                                        ///< Pointer to element.
+        using reference = T&;                                      ///< Reference to element.
+    private:
+        node* curr;          ///< Pointer to the current node.
+        unsigned int offset; ///< Position of the current element inside the node.
+        Unrolled_Linked_List<T, N>* list; ///< Pointer to the parent list.
+    public:
+        /**
+         * @brief Constructs an iterator for a given node, offset and list.
+         * @param p Pointer to the node.
+         * @param o Position of the element inside the node.
+         * @param l Pointer to the parent list.
+         */
+        Iterator(node* p, unsigned int o, Unrolled_Linked_List<T, N>* l);
+        /**
+         * @brief Default constructor. Creates an end iterator.
+         */
+        Iterator();
+        /**
+         * @brief Copy constructor.
+         * @param other The iterator to copy from.
+         */
+        Iterator(const Iterator& other);
+        /**
+         * @brief Assignment operator.
+         * @param other The iterator to assign from.
+         * @return Reference to this iterator.
+         */
+        Iterator& operator=(const Iterator& other);
+        /**
+         * @brief Checks if two iterators are equal.
+         * @param other The iterator to compare with.
+         * @return True if equal, false otherwise.
+         */
+        bool operator==(const Iterator& other) const;
+        /**
+         * @brief Checks if two iterators are not equal.
+         * @param other The iterator to compare with.
+         * @return True if not equal, false otherwise.
+         */
+        bool operator!=(const Iterator& other) const;
+        /**
+         * @brief Dereferences the iterator to access the element.
+         * @return Reference to the element.
+         */
+        T& operator*();
+        /**
+         * @brief Advances the iterator to the next element (prefix).
+         * @return Reference to this iterator.
+         */
+        Iterator& operator++();
+        /**
+         * @brief Advances the iterator to the next element (postfix).
+         * @return Iterator before increment.
+         */
+        Iterator operator++(int);
+        /**
+         * @brief Moves the iterator to the previous element (prefix).
+         * @return Reference to this iterator.
+         */
+        Iterator& operator--();
+        /**
+         * @brief Moves the iterator to the previous element (postfix).
+         * @return Iterator before decrement.
+         */
+        Iterator operator--(int);
+        /**
+         * @brief Accesses the element pointer.
+         * @return Pointer to the element.
+         */
+        T* operator->();
+    };
+
+    /**
+     * @brief Returns an iterator to the beginning of the list.
+     * @return Iterator to the first element.
+     */
+    Iterator begin();
+    /**
+     * @brief Returns an iterator to the end of the list.
+     * @return Iterator to one past the last element.
+     */
+    Iterator end();
+};
+
+#include "Unrolled_Linked_List.tpp"
+
+#endif // UNROLLED_LINKED_LIST_H
@@ -0,0 +1,382 @@
+/**
+ * @file Unrolled_Linked_List.tpp
+ * @brief Implementation file for the Unrolled_Linked_List template class.
+ * @see Unrolled_Linked_List.h for class documentation.
+ */
+
+#include "Unrolled_Linked_List.hpp"
+#include <type_traits>
+#include <utility>
+
+template <class T, unsigned int N>
+Unrolled_Linked_List<T, N>::Unrolled_Linked_List() : front(nullptr), back(nullptr), length(0) {}
+
+template <class T, unsigned int N>
+Unrolled_Linked_List<T, N>::~Unrolled_Linked_List() {
+    clear();
+}
+
+template <class T, unsigned int N>
+Unrolled_Linked_List<T, N>::Unrolled_Linked_List(std::initializer_list<T> array) : front(nullptr), back(nullptr), length(0) {
+    for (const T& item : array) {
+        push_back(item);
+    }
+}
+
+template <class T, unsigned int N>
+Unrolled_Linked_List<T, N>& Unrolled_Linked_List<T, N>::operator=(std::initializer_list<T> array) {
+    clear();
+    for (const T& item : array) {
+        push_back(item);
+    }
+    return *this;
+}
+
+template <class T, unsigned int N>
+Unrolled_Linked_List<T, N>::Unrolled_Linked_List(const Unrolled_Linked_List& other) : front(nullptr), back(nullptr), length(0) {
+    for (node* temp = other.front; temp != nullptr; temp = temp->next) {
+        node* copy = link_after(back);
+        for (unsigned int i = 0; i < temp->count; ++i) {
+            copy->items[i] = temp->items[i];
+        }
+        copy->count = temp->count;
+        length += temp->count;
+    }
+}
+
+template <class T, unsigned int N>
+Unrolled_Linked_List<T, N>& Unrolled_Linked_List<T, N>::operator=(const Unrolled_Linked_List& other) {
+    if (this != &other) {
+        clear();
+        for (node* temp = other.front; temp != nullptr; temp = temp->next) {
+            node* copy = link_after(back);
+            for (unsigned int i = 0; i < temp->count; ++i) {
+                copy->items[i] = temp->items[i];
+            }
+            copy->count = temp->count;
+            length += temp->count;
+        }
+    }
+    return *this;
+}
+
+template <class T, unsigned int N>
+unsigned long long Unrolled_Linked_List<T, N>::get_length() const {
+    return length;
+}
+
+template <class T, unsigned int N>
+bool Unrolled_Linked_List<T, N>::empty() const {
+    return length == 0;
+}
+
+template <class T, unsigned int N>
+typename Unrolled_Linked_List<T, N>::node* Unrolled_Linked_List<T, N>::locate(unsigned long long index, unsigned int& offset) const {
+    if (index < length / 2) {
+        node* temp = front;
+        while (index >= temp->count) {
+            index -= temp->count;
+            temp = temp->next;
+        }
+        offset = static_cast<unsigned int>(index);
+        return temp;
+    }
+    node* temp = back;
+    unsigned long long from_back = length - 1 - index;
+    while (from_back >= temp->count) {
+        from_back -= temp->count;
+        temp = temp->prev;
+    }
+    offset = static_cast<unsigned int>(temp->count - 1 - from_back);
+    return temp;
+}
+
+template <class T, unsigned int N>
+typename Unrolled_Linked_List<T, N>::node* Unrolled_Linked_List<T, N>::link_after(node* pos) {
+    node* new_node = new node;
+    new_node->count = 0;
+    new_node->prev = pos;
+    new_node->next = (pos != nullptr) ? pos->next : front;
+    if (new_node->next != nullptr) {
+        new_node->next->prev = new_node;
+    } else {
+        back = new_node;
+    }
+    if (pos != nullptr) {
+        pos->next = new_node;
+    } else {
+        front = new_node;
+    }
+    return new_node;
+}
+
+template <class T, unsigned int N>
+void Unrolled_Linked_List<T, N>::unlink(node* old_node) {
+    if (old_node->prev != nullptr) {
+        old_node->prev->next = old_node->next;
+    } else {
+        front = old_node->next;
+    }
+    if (old_node->next != nullptr) {
+        old_node->next->prev = old_node->prev;
+    } else {
+        back = old_node->prev;
+    }
+    delete old_node;
+}
+
+template <class T, unsigned int N>
+void Unrolled_Linked_List<T, N>::split(node* full) {
+    node* half = link_after(full);
+    const unsigned int keep = N / 2;
+    for (unsigned int i = keep; i < full->count; ++i) {
+        half->items[i - keep] = std::move(full->items[i]);
+    }
+    half->count = full->count - keep;
+    full->count = keep;
+}
+
+template <class T, unsigned int N>
+void Unrolled_Linked_List<T, N>::rebalance(node* ptr) {
+    if (ptr->count == 0) {
+        unlink(ptr);
+        return;
+    }
+    node* next_node = ptr->next;
+    if (ptr->count >= N / 2 || next_node == nullptr) {
+        return;
+    }
+    if (ptr->count + next_node->count <= N) {
+        // Merge the successor into this node
+        for (unsigned int i = 0; i < next_node->count; ++i) {
+            ptr->items[ptr->count + i] = std::move(next_node->items[i]);
+        }
+        ptr->count += next_node->count;
+        unlink(next_node);
+    } else {
+        // Borrow the first element of the successor
+        ptr->items[ptr->count++] = std::move(next_node->items[0]);
+        for (unsigned int i = 1; i < next_node->count; ++i) {
+            next_node->items[i - 1] = std::move(next_node->items[i]);
+        }
+        --next_node->count;
+    }
+}
+
+template <class T, unsigned int N>
+void Unrolled_Linked_List<T, N>::push_back(T new_item) {
+    if (back == nullptr || back->count == N) {
+        link_after(back);
+    }
+    back->items[back->count++] = std::move(new_item);
+    ++length;
+}
+
+template <class T, unsigned int N>
+void Unrolled_Linked_List<T, N>::push_front(T new_item) {
+    insert(0, std::move(new_item));
+}
+
+template <class T, unsigned int N>
+void Unrolled_Linked_List<T, N>::insert(const unsigned long long index, T new_item) {
+    if (index > length) {
+        throw std::out_of_range("Index out of range in insert()");
+    }
+    if (index == length) {
+        push_back(std::move(new_item));
+        return;
+    }
+
+    unsigned int offset;
+    node* temp = locate(index, offset);
+    if (temp->count == N) {
+        split(temp);
+        if (offset > temp->count) {
+            offset -= temp->count;
+            temp = temp->next;
+        }
+    }
+    for (unsigned int i = temp->count; i > offset; --i) {
+        temp->items[i] = std::move(temp->items[i - 1]);
+    }
+    temp->items[offset] = std::move(new_item);
+    ++temp->count;
+    ++length;
+}
+
+template <class T, unsigned int N>
+void Unrolled_Linked_List<T, N>::pop_back() {
+    if (empty()) return;
+    --back->count;
+    if constexpr (!std::is_trivially_destructible<T>::value) {
+        // Release what the element holds instead of keeping it alive in the vacated slot
+        back->items[back->count] = T();
+    }
+    --length;
+    if (back->count == 0) {
+        unlink(back);
+    }
+}
+
+template <class T, unsigned int N>
+void Unrolled_Linked_List<T, N>::pop_front() {
+    if (empty()) return;
+    erase(0);
+}
+
+template <class T, unsigned int N>
+void Unrolled_Linked_List<T, N>::erase(unsigned long long index) {
+    if (index >= length) {
+        throw std::out_of_range("Index out of range in erase()");
+    }
+    unsigned int offset;
+    node* temp = locate(index, offset);
+    for (unsigned int i = offset + 1; i < temp->count; ++i) {
+        temp->items[i - 1] = std::move(temp->items[i]);
+    }
+    --temp->count;
+    if constexpr (!std::is_trivially_destructible<T>::value) {
+        temp->items[temp->count] = T();
+    }
+    --length;
+    rebalance(temp);
+}
+
+template <class T, unsigned int N>
+void Unrolled_Linked_List<T, N>::clear() {
+    node* current = front;
+    while (current != nullptr) {
+        node* next_node = current->next;
+        delete current;
+        current = next_node;
+    }
+    front = back = nullptr;
+    length = 0;
+}
+
+template <class T, unsigned int N>
+void Unrolled_Linked_List<T, N>::print() const {
+    std::cout << "[ ";
+    for (node* temp = front; temp != nullptr; temp = temp->next) {
+        for (unsigned int i = 0; i < temp->count; ++i) {
+            std::cout << temp->items[i] << ' ';
+        }
+    }
+    std::cout << ']' << std::endl;
+}
+
+template <class T, unsigned int N>
+T& Unrolled_Linked_List<T, N>::operator[](const long long index) {
+    if (index < 0 || static_cast<unsigned long long>(index) >= length) {
+        throw std::out_of_range("Index out of range in operator[]");
+    }
+    unsigned int offset;
+    node* temp = locate(static_cast<unsigned long long>(index), offset);
+    return temp->items[offset];
+}
+
+template <class T, unsigned int N>
+T& Unrolled_Linked_List<T, N>::at(const long long index) {
+    if (index < 0 || static_cast<unsigned long long>(index) >= length) {
+        throw std::out_of_range("Index out of range in at()");
+    }
+    return operator[](index);
+}
+
+template <class T, unsigned int N>
+Unrolled_Linked_List<T, N>::Iterator::Iterator(node* p, unsigned int o, Unrolled_Linked_List<T, N>* l) : curr(p), offset(o), list(l) {}
+
+template <class T, unsigned int N>
+Unrolled_Linked_List<T, N>::Iterator::Iterator() : curr(nullptr), offset(0), list(nullptr) {}
+
+template <class T, unsigned int N>
+Unrolled_Linked_List<T, N>::Iterator::Iterator(const Iterator& other) : curr(other.curr), offset(other.offset), list(other.list) {}
+
+template <class T, unsigned int N>
+typename Unrolled_Linked_List<T, N>::Iterator& Unrolled_Linked_List<T, N>::Iterator::operator=(const Iterator& other) {
+    if (this != &other) {
+        curr = other.curr;
+        offset = other.offset;
+        list = other.list;
+    }
+    return *this;
+}
+
+template <class T, unsigned int N>
+bool Unrolled_Linked_List<T, N>::Iterator::operator==(const Iterator& other) const {
+    return curr == other.curr && offset == other.offset;
+}
+
+template <class T, unsigned int N>
+bool Unrolled_Linked_List<T, N>::Iterator::operator!=(const Iterator& other) const {
+    return !(*this == other);
+}
+
+template <class T, unsigned int N>
+T& Unrolled_Linked_List<T, N>::Iterator::operator*() {
+    if (curr) {
+        return curr->items[offset];
+    }
+    throw std::runtime_error("Dereferencing a null iterator.");
+}
+
+template <class T, unsigned int N>
+typename Unrolled_Linked_List<T, N>::Iterator& Unrolled_Linked_List<T, N>::Iterator::operator++() {
+    if (curr) {
+        if (++offset == curr->count) {
+            curr = curr->next;
+            offset = 0;
+        }
+    }
+    return *this;
+}
+
+template <class T, unsigned int N>
+typename Unrolled_Linked_List<T, N>::Iterator Unrolled_Linked_List<T, N>::Iterator::operator++(int) {
+    Iterator temp = *this;
+    ++(*this);
+    return temp;
+}
+
+template <class T, unsigned int N>
+typename Unrolled_Linked_List<T, N>::Iterator& Unrolled_Linked_List<T, N>::Iterator::operator--() {
+    if (!curr) {
+        if (list && !list->empty()) {
+            curr = list->back;
+            offset = curr->count - 1;
+        }
+        return *this;
+    }
+    if (offset > 0) {
+        --offset;
+    } else {
+        curr = curr->prev;
+        offset = (curr != nullptr) ? curr->count - 1 : 0;
+    }
+    return *this;
+}
+
+template <class T, unsigned int N>
+typename Unrolled_Linked_List<T, N>::Iterator Unrolled_Linked_List<T, N>::Iterator::operator--(int) {
+    Iterator temp = *this;
+    --(*this);
+    return temp;
+}
+
+template <class T, unsigned int N>
+T* Unrolled_Linked_List<T, N>::Iterator::operator->() {
+    if (!curr) {
+        throw std::runtime_error("Cannot access member via end() iterator");
+    }
+    return &(curr->items[offset]);
+}
+
+template <class T, unsigned int N>
+typename Unrolled_Linked_List<T, N>::Iterator Unrolled_Linked_List<T, N>::begin() {
+    return Iterator(front, 0, this);
+}
+
+template <class T, unsigned int N>
+typename Unrolled_Linked_List<T, N>::Iterator Unrolled_Linked_List<T, N>::end() {
+    return Iterator(nullptr, 0, this);
+}
@@ -52,6 +52,17 @@ public:
      * @return Reference to this queue.
      */
     Linked_Queue& operator=(const Linked_Queue& other);
+    /**
+     * @brief Move constructor. Steals the node chain of another queue.
+     * @param other The queue to move from. Left empty.
+     */
+    Linked_Queue(Linked_Queue&& other) noexcept;
+    /**
+     * @brief Move assignment operator. Steals the node chain of another queue.
+     * @param other The queue to move from. Left empty.
+     * @return Reference to this queue.
+     */
+    Linked_Queue& operator=(Linked_Queue&& other) noexcept;
     /**
      * @brief Returns the number of elements in the queue.
      * @return The number of elements.
@@ -88,6 +99,28 @@ public:
      * @brief Clears the queue.
      */
     void clear();
+    /**
+     * @brief Appends every element of another queue to the rear of this one in O(1).
+     * @param other The queue whose nodes are relinked. Left empty.
+     */
+    void splice_back(Linked_Queue& other);
+    /**
+     * @brief Moves every element of this queue to the rear of another queue in O(1).
+     * @param other The queue that receives the nodes.
+     */
+    void drain_into(Linked_Queue& other);
+    /**
+     * @brief Detaches the whole contents of the queue in O(1).
+     * @return A queue holding every element, in the same order. This queue is left empty.
+     */
+    Linked_Queue take_all();
+    /**
+     * @brief Detaches the first n elements of the queue.
+     * @param n The number of elements to detach.
+     * @return A queue holding the first n elements, in the same order.
+     * @throws std::out_of_range if n is greater than the length of the queue.
+     */
+    Linked_Queue split_front(unsigned long long n);
     /**
      * @brief Prints the contents of the queue to standard output.
      */
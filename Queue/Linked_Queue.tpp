@@ -52,6 +52,21 @@ Linked_Queue<T>& Linked_Queue<T>::operator=(const Linked_Queue<T>& other) {
     return *this;
 }
 
+template <class T>
+Linked_Queue<T>::Linked_Queue(Linked_Queue<T>&& other) noexcept : front(other.front), back(other.back), length(other.length) {
+    other.front = other.back = nullptr;
+    other.length = 0;
+}
+
+template <class T>
+Linked_Queue<T>& Linked_Queue<T>::operator=(Linked_Queue<T>&& other) noexcept {
+    if (this != &other) {
+        clear();
+        splice_back(other);
+    }
+    return *this;
+}
+
 template <class T>
 unsigned long long Linked_Queue<T>::get_length() const {
     return length;
@@ -109,6 +124,57 @@ void Linked_Queue<T>::clear() {
     }
 }
 
+template <class T>
+void Linked_Queue<T>::splice_back(Linked_Queue<T>& other) {
+    if (this == &other || other.empty()) return;
+    if (empty()) {
+        front = other.front;
+    } else {
+        back->next = other.front;
+    }
+    back = other.back;
+    length += other.length;
+    other.front = other.back = nullptr;
+    other.length = 0;
+}
+
+template <class T>
+void Linked_Queue<T>::drain_into(Linked_Queue<T>& other) {
+    other.splice_back(*this);
+}
+
+template <class T>
+Linked_Queue<T> Linked_Queue<T>::take_all() {
+    Linked_Queue<T> result;
+    result.splice_back(*this);
+    return result;
+}
+
+template <class T>
+Linked_Queue<T> Linked_Queue<T>::split_front(unsigned long long n) {
+    if (n > length) {
+        throw std::out_of_range("Count out of range in split_front()");
+    }
+    if (n == length) {
+        return take_all();
+    }
+    Linked_Queue<T> result;
+    if (n == 0) {
+        return result;
+    }
+    node* last = front;
+    for (unsigned long long i = 1; i < n; ++i) {
+        last = last->next;
+    }
+    result.front = front;
+    result.back = last;
+    result.length = n;
+    front = last->next;
+    last->next = nullptr;
+    length -= n;
+    return result;
+}
+
 template <class T>
 void Linked_Queue<T>::print() const {
     node* temp = front;
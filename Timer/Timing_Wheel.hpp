@@ -0,0 +1,151 @@
+/**
+ * @file Timing_Wheel.h
+ * @brief Declaration of a hierarchical hashed timing wheel with doubly linked slot lists.
+ */
+
+#ifndef TIMING_WHEEL_H
+#define TIMING_WHEEL_H
+
+#include "../Linked-List/Doubly_Linked_List.hpp"
+#include "../Hash-Table/List_Index.hpp"
+
+/**
+ * @class Timing_Wheel
+ * @brief A generic timer scheduler with O(1) schedule, cancel and per-tick expiry.
+ *
+ * Time advances in integer ticks. The wheel has LEVELS levels of SLOTS slots; level L
+ * covers delays below SLOTS^(L+1) ticks with a resolution of SLOTS^L ticks, so four levels
+ * of 256 slots span 2^32 ticks. Each slot is a Doubly_Linked_List of timers. Whenever the
+ * low bits of the current tick roll over, the matching slot of the next level is cascaded:
+ * its timers are spliced into the lower level they now belong to. Longer delays are parked
+ * in the top level and re-cascaded until they come into range.
+ *
+ * schedule() returns a timer id; an open-addressing index maps ids to list nodes, so
+ * cancel() unlinks a timer in O(1) expected time. Ids of timers that fired or were
+ * cancelled are simply no longer found.
+ *
+ * @tparam T The payload delivered to the expiry callback.
+ */
+template <class T>
+class Timing_Wheel {
+public:
+    static constexpr unsigned int SLOT_BITS = 8;              ///< log2 of the number of slots per level.
+    static constexpr unsigned int SLOTS = 1u << SLOT_BITS;    ///< Number of slots per level.
+    static constexpr unsigned int LEVELS = 4;                 ///< Number of wheel levels.
+
+private:
+    /**
+     * @struct timer
+     * @brief A pending timer and its current position in the wheel.
+     */
+    struct timer {
+        unsigned long long id;     ///< Id returned by schedule().
+        unsigned long long expiry; ///< Absolute tick at which the timer fires.
+        unsigned int level;        ///< Level of the slot holding the timer.
+        unsigned int slot;         ///< Index of the slot holding the timer.
+        T payload;                 ///< Value delivered to the expiry callback.
+    };
+
+    using list_iterator = typename Doubly_Linked_List<timer>::Iterator;
+
+    /**
+     * @struct key_of
+     * @brief Reads the id of the timer a list iterator points to.
+     */
+    struct key_of {
+        const unsigned long long& operator()(list_iterator position) const { return position->id; }
+    };
+
+    Doubly_Linked_List<timer> wheel[LEVELS][SLOTS]; ///< The slot lists of every level.
+    List_Index<unsigned long long, list_iterator, key_of> index; ///< Timer id to list node index.
+    unsigned long long now;     ///< The current tick.
+    unsigned long long next_id; ///< Id handed out by the next schedule().
+
+    /**
+     * @brief Picks the level and slot matching a timer's remaining delay.
+     * @param entry The timer; its level and slot fields are updated.
+     */
+    void assign_slot(timer& entry) const;
+    /**
+     * @brief Moves a timer from a list into the slot matching its remaining delay.
+     * @param position Iterator to the timer.
+     * @param from The list currently holding the timer.
+     */
+    void place(list_iterator position, Doubly_Linked_List<timer>& from);
+    /**
+     * @brief Redistributes the timers of a slot into the levels they now belong to.
+     * @param level The level of the slot.
+     * @param slot The index of the slot.
+     */
+    void cascade(unsigned int level, unsigned int slot);
+
+public:
+    /**
+     * @brief Default constructor. Creates an empty wheel at tick 0.
+     */
+    Timing_Wheel();
+    /**
+     * @brief Copying is disabled: the index refers to the nodes of this wheel.
+     */
+    Timing_Wheel(const Timing_Wheel&) = delete;
+    /**
+     * @brief Copy assignment is disabled: the index refers to the nodes of this wheel.
+     */
+    Timing_Wheel& operator=(const Timing_Wheel&) = delete;
+    /**
+     * @brief Returns the current tick.
+     * @return The number of ticks advanced so far.
+     */
+    [[nodiscard]] unsigned long long get_now() const;
+    /**
+     * @brief Returns the number of pending timers.
+     * @return The number of timers that have neither fired nor been cancelled.
+     */
+    [[nodiscard]] unsigned long long get_pending() const;
+    /**
+     * @brief Checks if no timers are pending.
+     * @return True if the wheel is empty, false otherwise.
+     */
+    [[nodiscard]] bool empty() const;
+    /**
+     * @brief Schedules a timer.
+     * @param delay Number of ticks until the timer fires; 0 is treated as 1.
+     * @param payload Value delivered to the expiry callback.
+     * @return Id of the new timer (never 0).
+     */
+    unsigned long long schedule(unsigned long long delay, T payload);
+    /**
+     * @brief Cancels a pending timer in O(1) expected time.
+     * @param id Id returned by schedule().
+     * @return True if the timer was pending, false if it already fired or was cancelled.
+     */
+    bool cancel(unsigned long long id);
+    /**
+     * @brief Checks whether a timer is still pending.
+     * @param id Id returned by schedule().
+     * @return True if the timer is pending, false otherwise.
+     */
+    [[nodiscard]] bool is_pending(unsigned long long id) const;
+    /**
+     * @brief Advances time and fires every timer that comes due.
+     *
+     * On each tick all timers due at that tick are detached and unindexed as one batch
+     * before any callback runs, so callbacks may freely schedule or cancel timers; timers
+     * they schedule fire at the next tick at the earliest.
+     *
+     * @tparam Function Callable taking a T&, invoked once per expired timer.
+     * @param ticks Number of ticks to advance.
+     * @param on_expired The expiry callback.
+     * @return Number of timers that fired.
+     */
+    template <class Function>
+    unsigned long long advance(unsigned long long ticks, Function on_expired);
+    /**
+     * @brief Cancels every pending timer. The current tick is kept.
+     */
+    void clear();
+};
+
+#include "Timing_Wheel.tpp"
+
+#endif // TIMING_WHEEL_H
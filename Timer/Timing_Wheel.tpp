@@ -0,0 +1,128 @@
+/**
+ * @file Timing_Wheel.tpp
+ * @brief Implementation file for the Timing_Wheel template class.
+ * @see Timing_Wheel.h for class documentation.
+ */
+
+#include "Timing_Wheel.hpp"
+#include <utility>
+
+template <class T>
+Timing_Wheel<T>::Timing_Wheel() : now(0), next_id(1) {}
+
+template <class T>
+unsigned long long Timing_Wheel<T>::get_now() const {
+    return now;
+}
+
+template <class T>
+unsigned long long Timing_Wheel<T>::get_pending() const {
+    return index.get_size();
+}
+
+template <class T>
+bool Timing_Wheel<T>::empty() const {
+    return index.get_size() == 0;
+}
+
+template <class T>
+void Timing_Wheel<T>::assign_slot(timer& entry) const {
+    const unsigned long long delay = entry.expiry - now;
+    unsigned int level = 0;
+    while (level + 1 < LEVELS && delay >> (SLOT_BITS * (level + 1)) != 0) {
+        ++level;
+    }
+    // Delays beyond the top level are parked in its farthest slot and re-cascaded later
+    const unsigned long long span = 1ULL << (SLOT_BITS * LEVELS);
+    const unsigned long long target = (delay < span) ? entry.expiry : now + span - 1;
+    entry.level = level;
+    entry.slot = static_cast<unsigned int>(target >> (SLOT_BITS * level)) & (SLOTS - 1);
+}
+
+template <class T>
+void Timing_Wheel<T>::place(list_iterator position, Doubly_Linked_List<timer>& from) {
+    assign_slot(*position);
+    Doubly_Linked_List<timer>& to = wheel[position->level][position->slot];
+    to.splice(to.end(), from, position);
+}
+
+template <class T>
+void Timing_Wheel<T>::cascade(const unsigned int level, const unsigned int slot) {
+    Doubly_Linked_List<timer>& from = wheel[level][slot];
+    while (!from.empty()) {
+        place(from.begin(), from);
+    }
+}
+
+template <class T>
+unsigned long long Timing_Wheel<T>::schedule(const unsigned long long delay, T payload) {
+    const unsigned long long id = next_id++;
+    timer entry{id, now + (delay != 0 ? delay : 1), 0, 0, std::move(payload)};
+    assign_slot(entry);
+    Doubly_Linked_List<timer>& to = wheel[entry.level][entry.slot];
+    to.push_back(std::move(entry));
+    list_iterator position = to.end();
+    --position;
+    index.insert(position);
+    return id;
+}
+
+template <class T>
+bool Timing_Wheel<T>::cancel(const unsigned long long id) {
+    list_iterator position;
+    if (!index.find(id, position)) {
+        return false;
+    }
+    index.erase(id);
+    wheel[position->level][position->slot].erase(position);
+    return true;
+}
+
+template <class T>
+bool Timing_Wheel<T>::is_pending(const unsigned long long id) const {
+    list_iterator position;
+    return index.find(id, position);
+}
+
+template <class T>
+template <class Function>
+unsigned long long Timing_Wheel<T>::advance(unsigned long long ticks, Function on_expired) {
+    unsigned long long fired = 0;
+    Doubly_Linked_List<timer> batch;
+    while (ticks-- > 0) {
+        ++now;
+        // Cascade every level whose lower digits just rolled over, highest first
+        unsigned int top = 0;
+        while (top + 1 < LEVELS && (now & ((1ULL << (SLOT_BITS * (top + 1))) - 1)) == 0) {
+            ++top;
+        }
+        for (unsigned int level = top; level > 0; --level) {
+            cascade(level, static_cast<unsigned int>(now >> (SLOT_BITS * level)) & (SLOTS - 1));
+        }
+
+        Doubly_Linked_List<timer>& due = wheel[0][now & (SLOTS - 1)];
+        if (due.empty()) {
+            continue;
+        }
+        batch.splice(batch.end(), due);
+        for (list_iterator it = batch.begin(); it != batch.end(); ++it) {
+            index.erase(it->id);
+        }
+        for (list_iterator it = batch.begin(); it != batch.end(); ++it) {
+            on_expired(it->payload);
+            ++fired;
+        }
+        batch.clear();
+    }
+    return fired;
+}
+
+template <class T>
+void Timing_Wheel<T>::clear() {
+    index.clear();
+    for (unsigned int level = 0; level < LEVELS; ++level) {
+        for (unsigned int slot = 0; slot < SLOTS; ++slot) {
+            wheel[level][slot].clear();
+        }
+    }
+}
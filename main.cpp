@@ -4,10 +4,13 @@
  *
  * This file provides a comprehensive menu-driven interface to test and validate the
  * functionality of all implemented data structures, including:
- * - Linked Lists (Singly, Doubly, Array-based)
+ * - Linked Lists (Singly, Doubly, Array-based, Skip List, Unrolled, Intrusive)
  * - Stacks (Array-based, Linked List-based)
  * - Queues (Array-based, Linked List-based)
  * - Binary Trees (AVL self-balancing)
+ * - Hash Tables (insertion-ordered set and map)
+ * - Caches (LRU, sharded LRU)
+ * - Timers (hierarchical timing wheel)
  *
  * @author Eyad
  * @date 2025
@@ -29,14 +32,31 @@
 
 #include <iostream>
 #include <cassert>
+#include <vector>
+#include <utility>
+#include <functional>
+#include <string>
+#include <memory>
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <limits>
 #include "Linked-List/Doubly_Linked_List.hpp"
 #include "Linked-List/Linked_List.hpp"
 #include "Linked-List/Linked_List_Array.hpp"
+#include "Linked-List/Skip_List.hpp"
+#include "Linked-List/Unrolled_Linked_List.hpp"
+#include "Linked-List/Intrusive_List.hpp"
 #include "Stack/Array_Stack.hpp"
 #include "Stack/Linked_Stack.hpp"
 #include "Queue/Array_Queue.hpp"
 #include "Queue/Linked_Queue.hpp"
 #include "Binary-Tree/Binary_Tree.hpp"
+#include "Hash-Table/Linked_Hash_Set.hpp"
+#include "Hash-Table/Linked_Hash_Map.hpp"
+#include "Cache/LRU_Cache.hpp"
+#include "Cache/Sharded_LRU_Cache.hpp"
+#include "Timer/Timing_Wheel.hpp"
 
 /**
  * @brief Helper function to print test results with visual indicators
@@ -63,6 +83,10 @@ void print_test_result(const char* test_name, bool passed) {
  * - List manipulation (clear, reverse)
  * - Copy semantics (copy constructor, assignment operator)
  * - Initializer list constructor
+ * - Iterator-based editing (insert, erase, splice, extract)
+ * - Sorting, merging and removing consecutive duplicates
+ * - Memory relinearization (compact)
+ * - Traversal helpers (for_each, find, accumulate)
  * 
  * @note All tests use integer data type for simplicity
  * @see Doubly_Linked_List
@@ -120,6 +144,78 @@ void test_doubly_linked_list() {
     // Test reverse
     list2.reverse();
     print_test_result("Reverse", list2[0] == 5 && list2[4] == 1);
+
+    // Test iterator insert/erase
+    Doubly_Linked_List<int> list5 = {1, 2, 4};
+    Doubly_Linked_List<int>::Iterator it = list5.begin();
+    ++it;
+    it = list5.erase(it);
+    list5.insert(it, 3);
+    list5.insert(list5.end(), 5);
+    print_test_result("Iterator insert and erase", list5.get_length() == 4 && list5[1] == 3 && list5[2] == 4 && list5[3] == 5);
+
+    // Test splice
+    Doubly_Linked_List<int> list6 = {10, 20, 30};
+    Doubly_Linked_List<int>::Iterator last = list6.end();
+    --last;
+    list5.splice(list5.begin(), list6, list6.begin(), last);
+    list5.splice(list5.end(), list6);
+    print_test_result("Splice", list5.get_length() == 7 && list6.empty() && list5[0] == 10 && list5[1] == 20 && list5[6] == 30);
+
+    // Test extract and node handle insert
+    Doubly_Linked_List<int>::Node_Handle handle = list5.extract(list5.begin());
+    handle.value() = 11;
+    list6.insert(list6.end(), std::move(handle));
+    print_test_result("Extract and node handle insert", handle.empty() && list5.get_length() == 6 && list6.get_length() == 1 && list6[0] == 11);
+
+    // Test splicing the last element of another list to the end
+    list5.splice(list5.end(), list6, list6.begin());
+    print_test_result("Splice single element", list6.empty() && list5.get_length() == 7 && list5[6] == 11);
+
+    // Test sequential indexed access across structural edits
+    Doubly_Linked_List<int> list7;
+    for (int i = 0; i < 1000; ++i) {
+        list7.push_back(i);
+    }
+    bool sequential_ok = list7[500] == 500;
+    list7.insert(250, -1);
+    list7.erase(100);
+    list7.push_front(-2);
+    list7.reverse();
+    long long index = 0;
+    for (Doubly_Linked_List<int>::Iterator iter = list7.begin(); iter != list7.end(); ++iter, ++index) {
+        sequential_ok = sequential_ok && list7[index] == *iter;
+    }
+    sequential_ok = sequential_ok && list7[750] == -1 && list7[1000] == -2;
+    print_test_result("Sequential indexed access", sequential_ok);
+
+    // Test sort, merge and unique
+    Doubly_Linked_List<int> list8 = {5, 3, 9, 1, 3};
+    Doubly_Linked_List<int> list9 = {4, 3, 8};
+    list8.sort();
+    list9.sort();
+    list8.merge(list9);
+    unsigned long long duplicates = list8.unique();
+    list8.sort(std::greater<int>());
+    print_test_result("Sort, merge and unique", list9.empty() && duplicates == 2 && list8.get_length() == 6 && list8[0] == 9 && list8[5] == 1 && *(--list8.end()) == 1);
+
+    // Test compact keeps values and order
+    list8.push_front(10);
+    list8.erase(3);
+    list8.compact();
+    Doubly_Linked_List<int>::Iterator check = list8.begin();
+    bool compact_ok = list8.get_length() == 6;
+    for (int expected : {10, 9, 8, 4, 3, 1}) {
+        compact_ok = compact_ok && check != list8.end() && *check == expected;
+        ++check;
+    }
+    print_test_result("Compact", compact_ok && list8[5] == 1);
+
+    // Test traversal helpers
+    Doubly_Linked_List<int>::Iterator found = list8.find(4);
+    bool missing = list8.find(7) == list8.end();
+    list8.for_each([](int& x) { x *= 2; });
+    print_test_result("Traversal helpers", found != list8.end() && *found == 8 && missing && list8.accumulate(0) == 70 && list8.accumulate(0, std::plus<int>()) == 70);
 }
 
 /**
@@ -132,6 +228,11 @@ void test_doubly_linked_list() {
  * - List manipulation (clear, reverse)
  * - Copy semantics (copy constructor, assignment operator)
  * - Initializer list constructor
+ * - Iterator range constructor
+ * - Iterator-based editing (insert_after, erase_after, remove_if)
+ * - Sorting, merging and removing consecutive duplicates
+ * - Memory relinearization (compact)
+ * - Traversal helpers (for_each, find, accumulate)
  * 
  * @note All tests use integer data type for simplicity
  * @see Linked_List
@@ -186,9 +287,64 @@ void test_linked_list() {
     list4 = list2;
     print_test_result("Assignment operator", list4.get_length() == list2.get_length() && list4[0] == list2[0]);
 
+    // Test iterator range constructor and tail-tracked push_back after pops
+    std::vector<int> values = {7, 8, 9};
+    Linked_List<int> list5(values.begin(), values.end());
+    list5.pop_back();
+    list5.push_back(10);
+    print_test_result("Range constructor", list5.get_length() == 3 && list5[0] == 7 && list5[2] == 10);
+
     // Test reverse
     list2.reverse();
     print_test_result("Reverse", list2[0] == 5 && list2[4] == 1);
+
+    // Test insert_after/erase_after while scanning
+    Linked_List<int> list6 = {1, 2, 3, 4};
+    Linked_List<int>::Iterator prev = list6.before_begin();
+    for (Linked_List<int>::Iterator it = list6.begin(); it != list6.end();) {
+        if (*it % 2 == 0) {
+            it = list6.erase_after(prev);
+        } else {
+            prev = list6.insert_after(it, *it * 10);
+            it = prev;
+            ++it;
+        }
+    }
+    list6.insert_after(list6.before_begin(), 0);
+    print_test_result("Insert after and erase after", list6.get_length() == 5 && list6[0] == 0 && list6[2] == 10 && list6[4] == 30);
+
+    // Test remove_if
+    unsigned long long removed = list6.remove_if([](const int& x) { return x >= 10; });
+    list6.push_back(5);
+    print_test_result("Remove if", removed == 2 && list6.get_length() == 4 && list6[2] == 3 && list6[3] == 5);
+
+    // Test sort, merge and unique
+    Linked_List<int> list8 = {5, 3, 9, 1, 3};
+    Linked_List<int> list9 = {4, 3, 8};
+    list8.sort();
+    list9.sort();
+    list8.merge(list9);
+    unsigned long long duplicates = list8.unique();
+    list8.sort(std::greater<int>());
+    print_test_result("Sort, merge and unique", list9.empty() && duplicates == 2 && list8.get_length() == 6 && list8[0] == 9 && list8[5] == 1);
+
+    // Test compact keeps values and order
+    list8.push_front(10);
+    list8.erase(3);
+    list8.compact();
+    Linked_List<int>::Iterator check = list8.begin();
+    bool compact_ok = list8.get_length() == 6;
+    for (int expected : {10, 9, 8, 4, 3, 1}) {
+        compact_ok = compact_ok && check != list8.end() && *check == expected;
+        ++check;
+    }
+    print_test_result("Compact", compact_ok && list8[5] == 1);
+
+    // Test traversal helpers
+    Linked_List<int>::Iterator found = list8.find(4);
+    bool missing = list8.find(7) == list8.end();
+    list8.for_each([](int& x) { x *= 2; });
+    print_test_result("Traversal helpers", found != list8.end() && *found == 8 && missing && list8.accumulate(0) == 70 && list8.accumulate(0, std::plus<int>()) == 70);
 }
 
 /**
@@ -201,6 +357,11 @@ void test_linked_list() {
  * - List manipulation (clear, reverse)
  * - Copy semantics (copy constructor, assignment operator)
  * - Initializer list constructor
+ * - Iterator range constructor
+ * - Iterator-based editing (insert_after, erase_after, remove_if)
+ * - Sorting, merging and removing consecutive duplicates
+ * - Node pool slot reuse and iteration
+ * - Traversal helpers (for_each, find, accumulate)
  * 
  * @note All tests use integer data type for simplicity
  * @see Linked_List_Array
@@ -255,9 +416,78 @@ void test_linked_list_array() {
     list4 = list2;
     print_test_result("Assignment operator", list4.get_length() == list2.get_length() && list4[0] == list2[0]);
 
+    // Test iterator range constructor and tail-tracked push_back after pops
+    std::vector<int> values = {7, 8, 9};
+    Linked_List_Array<int> list5(values.begin(), values.end());
+    list5.pop_back();
+    list5.push_back(10);
+    print_test_result("Range constructor", list5.get_length() == 3 && list5[0] == 7 && list5[2] == 10);
+
+    // Test free-list slot reuse and O(1) clear
+    unsigned long long capacity = list5.get_capacity();
+    list5.erase(1);
+    list5.push_front(6);
+    int sum = 0;
+    for (Linked_List_Array<int>::Iterator it = list5.begin(); it != list5.end(); ++it) {
+        sum += *it;
+    }
+    list5.clear();
+    print_test_result("Node pool reuse", list5.get_capacity() == capacity && sum == 23 && list5.empty());
+
+    // Test that clear releases what non-trivial elements hold
+    std::shared_ptr<int> shared_item = std::make_shared<int>(7);
+    Linked_List_Array<std::shared_ptr<int>> owners;
+    for (int i = 0; i < 3; ++i) {
+        owners.push_back(shared_item);
+    }
+    owners.clear();
+    print_test_result("Clear releases elements", shared_item.use_count() == 1 && owners.empty());
+
+    // Test that assigning a shorter list releases the leftover slots
+    Linked_List_Array<std::shared_ptr<int>> longer = {std::make_shared<int>(1), shared_item};
+    Linked_List_Array<std::shared_ptr<int>> shorter = {std::make_shared<int>(2)};
+    longer = shorter;
+    print_test_result("Assignment releases elements", shared_item.use_count() == 1 && longer.get_length() == 1);
+
     // Test reverse
     list2.reverse();
     print_test_result("Reverse", list2[0] == 5 && list2[4] == 1);
+
+    // Test insert_after/erase_after while scanning
+    Linked_List_Array<int> list6 = {1, 2, 3, 4};
+    Linked_List_Array<int>::Iterator prev = list6.before_begin();
+    for (Linked_List_Array<int>::Iterator it = list6.begin(); it != list6.end();) {
+        if (*it % 2 == 0) {
+            it = list6.erase_after(prev);
+        } else {
+            prev = list6.insert_after(it, *it * 10);
+            it = prev;
+            ++it;
+        }
+    }
+    list6.insert_after(list6.before_begin(), 0);
+    print_test_result("Insert after and erase after", list6.get_length() == 5 && list6[0] == 0 && list6[2] == 10 && list6[4] == 30);
+
+    // Test remove_if
+    unsigned long long removed = list6.remove_if([](const int& x) { return x >= 10; });
+    list6.push_back(5);
+    print_test_result("Remove if", removed == 2 && list6.get_length() == 4 && list6[2] == 3 && list6[3] == 5);
+
+    // Test sort, merge and unique
+    Linked_List_Array<int> list8 = {5, 3, 9, 1, 3};
+    Linked_List_Array<int> list9 = {4, 3, 8};
+    list8.sort();
+    list9.sort();
+    list8.merge(list9);
+    unsigned long long duplicates = list8.unique();
+    list8.sort(std::greater<int>());
+    print_test_result("Sort, merge and unique", list9.empty() && duplicates == 2 && list8.get_length() == 6 && list8[0] == 9 && list8[5] == 1);
+
+    // Test traversal helpers
+    Linked_List_Array<int>::Iterator found = list8.find(4);
+    bool missing = list8.find(7) == list8.end();
+    list8.for_each([](int& x) { x *= 2; });
+    print_test_result("Traversal helpers", found != list8.end() && *found == 8 && missing && list8.accumulate(0) == 60 && list8.accumulate(0, std::plus<int>()) == 60);
 }
 
 /**
@@ -412,6 +642,7 @@ void test_array_queue() {
  * - Copy semantics (copy constructor, assignment operator)
  * - Initializer list constructor
  * - Clear functionality
+ * - Chain transfer (splice_back, drain_into, take_all, split_front)
  * 
  * @note All tests use integer data type for simplicity
  * @see Linked_Queue
@@ -446,6 +677,20 @@ void test_linked_queue() {
     queue4 = queue2;
     print_test_result("Assignment operator", !queue4.empty() && queue4.front_item() == queue2.front_item() && queue4.back_item() == queue2.back_item());
 
+    // Test splice_back
+    Linked_Queue<int> queue5 = {6, 7};
+    queue4.splice_back(queue5);
+    print_test_result("Splice back", queue4.get_length() == 7 && queue4.back_item() == 7 && queue5.empty());
+
+    // Test split_front
+    Linked_Queue<int> head = queue4.split_front(2);
+    print_test_result("Split front", head.get_length() == 2 && head.back_item() == 2 && queue4.front_item() == 3);
+
+    // Test drain_into and take_all
+    head.drain_into(queue4);
+    Linked_Queue<int> all = queue4.take_all();
+    print_test_result("Drain into and take all", queue4.empty() && head.empty() && all.get_length() == 7 && all.back_item() == 2);
+
     // Test clear
     queue2.clear();
     print_test_result("Clear", queue2.empty());
@@ -459,6 +704,16 @@ void test_linked_queue() {
  * - Element insertion with AVL balancing
  * - Tree traversal methods (pre-order, in-order, post-order, level-order)
  * - AVL self-balancing (left rotation, right rotation, complex scenarios)
+ * - Lookups (find, contains, lower_bound, upper_bound, equal_range)
+ * - Erasure by key and by node with rebalancing
+ * - Copy, move, size and clear over arena-backed node storage
+ * - Insert results and in-place emplace
+ * - Bidirectional, reverse and const iterators, predecessor and erase by iterator
+ * - Visitor traversals with early exit and export to an output iterator
+ * - Bulk construction from sorted ranges and batch insertion
+ * - Order-statistic policy (rank, select, count_range)
+ * - Monoid policy range aggregates (sum, max)
+ * - Join, split and set operations (union, intersection, difference)
  * - Edge cases (duplicate insertions)
  * 
  * @note All tests use integer data type for simplicity
@@ -496,6 +751,18 @@ void test_binary_tree() {
     std::cout << "  Level-order traversal:" << std::endl;
     tree.levelOrder();
 
+    // Test lookups
+    print_test_result("Find and contains", tree.find(40) != tree.end() && *tree.find(40) == 40 &&
+                      tree.contains(80) && !tree.contains(45) && tree.find(10) == tree.end());
+    print_test_result("Lower bound", *tree.lower_bound(45) == 50 && *tree.lower_bound(50) == 50 &&
+                      *tree.lower_bound(5) == 20 && tree.lower_bound(85) == tree.end());
+    print_test_result("Upper bound", *tree.upper_bound(50) == 60 && *tree.upper_bound(45) == 50 &&
+                      tree.upper_bound(80) == tree.end());
+    auto present = tree.equal_range(60);
+    auto absent = tree.equal_range(65);
+    print_test_result("Equal range", *present.first == 60 && *present.second == 70 &&
+                      absent.first == absent.second && *absent.first == 70);
+
     // Test AVL balancing (insert elements that would cause rebalancing)
     Binary_Tree<int> avl_tree;
     avl_tree.insert(10);
@@ -518,6 +785,199 @@ void test_binary_tree() {
     complex_tree.insert(45);
     print_test_result("Complex AVL balancing", true);
 
+    // Test erase (leaf, one child, two children, root, missing key)
+    bool erased = complex_tree.erase(10) && complex_tree.erase(20) && complex_tree.erase(30) &&
+                  complex_tree.erase(50) && !complex_tree.erase(99);
+    std::vector<int> remaining(complex_tree.lower_bound(0), complex_tree.end());
+    print_test_result("Erase by key", erased && remaining == std::vector<int>({25, 35, 40, 45, 60, 70, 80}));
+
+    auto next = complex_tree.erase(complex_tree.find(40));
+    print_test_result("Erase found element", next != complex_tree.end() && *next == 45 && !complex_tree.contains(40) &&
+                      complex_tree.erase(complex_tree.find(80)) == complex_tree.end());
+
+    Binary_Tree<int> drain_tree;
+    for (int i = 0; i < 100; ++i) {
+        drain_tree.insert(i);
+    }
+    for (int i = 0; i < 100; i += 2) {
+        drain_tree.erase(i);
+    }
+    bool odd_only = true;
+    int expected = 1;
+    for (auto it = drain_tree.lower_bound(0); it != drain_tree.end(); ++it, expected += 2) {
+        odd_only = odd_only && *it == expected;
+    }
+    print_test_result("Erase keeps order", odd_only && expected == 101);
+
+    // Test copy, move, size and clear
+    Binary_Tree<int> copy_tree(drain_tree);
+    copy_tree.erase(1);
+    Binary_Tree<int> moved_tree(std::move(copy_tree));
+    print_test_result("Copy and move", drain_tree.get_size() == 50 && drain_tree.contains(1) &&
+                      moved_tree.get_size() == 49 && !moved_tree.contains(1) && copy_tree.empty());
+
+    Binary_Tree<std::string> string_tree;
+    for (int i = 0; i < 1000; ++i) {
+        string_tree.insert("key-" + std::to_string(i));
+    }
+    string_tree.clear();
+    string_tree.insert("again");
+    print_test_result("Clear and reuse", string_tree.get_size() == 1 && string_tree.contains("again") &&
+                      !string_tree.contains("key-1"));
+
+    // Test insert results and emplace
+    auto inserted = string_tree.insert(std::string("bravo"));
+    auto repeated = string_tree.insert("bravo");
+    auto emplaced = string_tree.emplace(3, 'z');
+    auto duplicate = string_tree.emplace("zzz");
+    print_test_result("Insert and emplace", inserted.second && !repeated.second && repeated.first == inserted.first &&
+                      emplaced.second && *emplaced.first == "zzz" && !duplicate.second &&
+                      duplicate.first == emplaced.first && string_tree.get_size() == 3);
+
+    // Test iterators
+    std::vector<int> ascending(moved_tree.begin(), moved_tree.end());
+    std::vector<int> descending(moved_tree.rbegin(), moved_tree.rend());
+    bool sorted_scan = ascending.size() == 49 && ascending.front() == 3 && ascending.back() == 99 &&
+                       std::vector<int>(ascending.rbegin(), ascending.rend()) == descending;
+    const Binary_Tree<int>& const_tree = moved_tree;
+    auto last = const_tree.end();
+    --last;
+    print_test_result("Iterators", sorted_scan && *last == 99 && const_tree.cbegin() == const_tree.begin() &&
+                      Binary_Tree<int>().begin() == Binary_Tree<int>().end());
+
+    print_test_result("Find predecessor", *std::prev(moved_tree.find(51)) == 49 &&
+                      moved_tree.find(3) == moved_tree.begin());
+
+    for (auto it = moved_tree.begin(); it != moved_tree.end();) {
+        it = (*it % 3 == 0) ? moved_tree.erase(it) : std::next(it);
+    }
+    bool no_multiples = moved_tree.get_size() == 32;
+    for (int value : moved_tree) {
+        no_multiples = no_multiples && value % 3 != 0;
+    }
+    print_test_result("Erase by iterator", no_multiples);
+
+    // Test visitor traversals
+    std::vector<int> pre_order, post_order, level_order, exported;
+    tree.visitPreOrder([&pre_order](const int& value) { pre_order.push_back(value); });
+    tree.visitPostOrder([&post_order](const int& value) { post_order.push_back(value); });
+    tree.visitLevelOrder([&level_order](const int& value) { level_order.push_back(value); });
+    tree.exportInOrder(std::back_inserter(exported));
+    print_test_result("Visitor traversals", pre_order == std::vector<int>({50, 30, 20, 40, 70, 60, 80}) &&
+                      post_order == std::vector<int>({20, 40, 30, 60, 80, 70, 50}) &&
+                      level_order == std::vector<int>({50, 30, 70, 20, 40, 60, 80}) &&
+                      exported == std::vector<int>({20, 30, 40, 50, 60, 70, 80}));
+
+    int visited = 0;
+    bool completed = tree.visitInOrder([&visited](int value) { ++visited; return value < 40; });
+    print_test_result("Visitor early exit", !completed && visited == 3 &&
+                      Binary_Tree<int>().visitInOrder([](int) { return false; }));
+
+    // Test bulk construction
+    std::vector<int> sorted_keys;
+    for (int i = 0; i < 1000; ++i) {
+        sorted_keys.push_back(i / 2);
+    }
+    Binary_Tree<int> bulk_tree;
+    bulk_tree.insert(-1);
+    bulk_tree.build_from_sorted(sorted_keys.begin(), sorted_keys.end());
+    bool unsorted_rejected = false;
+    try {
+        bulk_tree.build_from_sorted(sorted_keys.rbegin(), sorted_keys.rend());
+    } catch (const std::invalid_argument&) {
+        unsorted_rejected = true;
+    }
+    print_test_result("Build from sorted", bulk_tree.get_size() == 500 && !bulk_tree.contains(-1) &&
+                      *bulk_tree.begin() == 0 && *bulk_tree.rbegin() == 499 && unsorted_rejected);
+
+    std::vector<int> batch = {1200, 600, -5, 250, 600, 1000};
+    bulk_tree.bulk_insert(batch.begin(), batch.end());
+    std::vector<int> small_batch = {-7};
+    bulk_tree.bulk_insert(small_batch.begin(), small_batch.end());
+    print_test_result("Bulk insert", bulk_tree.get_size() == 505 && bulk_tree.contains(600) &&
+                      bulk_tree.contains(1200) && *bulk_tree.begin() == -7 &&
+                      std::is_sorted(bulk_tree.begin(), bulk_tree.end()));
+
+    // Test order statistics
+    Binary_Tree<int, Order_Statistics> ranked_tree;
+    for (int i = 1; i <= 100; ++i) {
+        ranked_tree.insert(i * 10);
+    }
+    for (int i = 2; i <= 100; i += 2) {
+        ranked_tree.erase(i * 10);
+    }
+    bool select_out_of_range = false;
+    try {
+        ranked_tree.select(50);
+    } catch (const std::out_of_range&) {
+        select_out_of_range = true;
+    }
+    print_test_result("Rank and select", ranked_tree.rank(10) == 0 && ranked_tree.rank(35) == 2 &&
+                      ranked_tree.rank(2000) == 50 && *ranked_tree.select(0) == 10 &&
+                      *ranked_tree.select(49) == 990 && *ranked_tree.select(ranked_tree.get_size() - 1 - 1) == 970 &&
+                      std::next(ranked_tree.select(48)) == ranked_tree.select(49) && select_out_of_range);
+    print_test_result("Count range", ranked_tree.count_range(10, 90) == 5 && ranked_tree.count_range(15, 25) == 0 &&
+                      ranked_tree.count_range(0, 5000) == 50 && ranked_tree.count_range(90, 10) == 0);
+
+    // Test range aggregates
+    Binary_Tree<int, Monoid_Augment<Sum_Monoid<long long>>> sum_tree;
+    Binary_Tree<int, Monoid_Augment<Max_Monoid<int>>> max_tree;
+    for (int i = 1; i <= 100; ++i) {
+        sum_tree.insert(i);
+        max_tree.insert(i);
+    }
+    sum_tree.erase(50);
+    max_tree.erase(100);
+    print_test_result("Range sum", sum_tree.aggregate(1, 10) == 55 && sum_tree.aggregate(45, 55) == 500 &&
+                      sum_tree.aggregate() == 5000 && sum_tree.aggregate(200, 300) == 0);
+    print_test_result("Range max", max_tree.aggregate(10, 20) == 20 && max_tree.aggregate(90, 150) == 99 &&
+                      max_tree.aggregate(150, 160) == std::numeric_limits<int>::lowest());
+
+    // Test join and split
+    Binary_Tree<int> low_tree, high_tree;
+    for (int i = 0; i < 20; ++i) {
+        low_tree.insert(i);
+        high_tree.insert(100 + i * 10);
+    }
+    Binary_Tree<int> joined = Binary_Tree<int>::join(std::move(low_tree), 50, std::move(high_tree));
+    bool join_out_of_order = false;
+    try {
+        Binary_Tree<int> small_tree;
+        small_tree.insert(60);
+        Binary_Tree<int>::join(std::move(small_tree), 50, Binary_Tree<int>());
+    } catch (const std::invalid_argument&) {
+        join_out_of_order = true;
+    }
+    std::pair<Binary_Tree<int>, Binary_Tree<int>> halves = Binary_Tree<int>::split(std::move(joined), 100);
+    halves.first.insert(-1);
+    halves.second.erase(190);
+    std::vector<int> lower_half, upper_half;
+    halves.first.exportInOrder(std::back_inserter(lower_half));
+    halves.second.exportInOrder(std::back_inserter(upper_half));
+    print_test_result("Join and split", joined.empty() && join_out_of_order &&
+                      halves.first.get_size() == 22 && lower_half.front() == -1 && lower_half.back() == 50 &&
+                      halves.second.get_size() == 19 && upper_half.front() == 100 && upper_half.back() == 290 &&
+                      !halves.second.contains(190));
+
+    // Test set operations
+    Binary_Tree<int> evens, threes, evens_copy, threes_copy;
+    for (int i = 0; i <= 30; ++i) {
+        if (i % 2 == 0) evens.insert(i);
+        if (i % 3 == 0) threes.insert(i);
+    }
+    evens_copy = evens;
+    threes_copy = threes;
+    Binary_Tree<int> both = Binary_Tree<int>::set_intersection(Binary_Tree<int>(evens), Binary_Tree<int>(threes));
+    Binary_Tree<int> only_evens = Binary_Tree<int>::set_difference(std::move(evens_copy), std::move(threes_copy));
+    Binary_Tree<int> either = Binary_Tree<int>::set_union(std::move(evens), std::move(threes));
+    std::vector<int> both_keys, only_keys;
+    both.exportInOrder(std::back_inserter(both_keys));
+    only_evens.exportInOrder(std::back_inserter(only_keys));
+    print_test_result("Set operations", either.get_size() == 21 && either.contains(9) && either.contains(10) &&
+                      !either.contains(7) && evens.empty() && threes.empty() &&
+                      both_keys == std::vector<int>{0, 6, 12, 18, 24, 30} &&
+                      only_keys == std::vector<int>{2, 4, 8, 10, 14, 16, 20, 22, 26, 28});
+
     // Test edge cases
     Binary_Tree<int> edge_tree;
     edge_tree.insert(1);
@@ -527,11 +987,454 @@ void test_binary_tree() {
     print_test_result("Edge cases (duplicates, etc.)", true);
 }
 
+/**
+ * @brief Comprehensive test suite for Skip List implementation
+ * 
+ * Tests all major operations of the Skip_List class:
+ * - Constructor and initialization (including level probability)
+ * - Positional insertion (push_back, push_front, insert)
+ * - Positional deletion (pop_back, pop_front, erase)
+ * - Indexed access against a reference sequence
+ * - Bidirectional iteration
+ * - Copy semantics (copy constructor, assignment operator)
+ * 
+ * @note All tests use integer data type for simplicity
+ * @see Skip_List
+ */
+void test_skip_list() {
+    std::cout << "\nTesting Skip List:" << std::endl;
+
+    // Test constructor and initial state
+    Skip_List<int> list(0.25);
+    print_test_result("Empty list initialization", list.empty() && list.get_length() == 0 && list.get_probability() == 0.25);
+
+    // Test push_back, push_front and insert
+    list.push_back(1);
+    list.push_back(3);
+    list.push_front(0);
+    list.insert(2, 2);
+    print_test_result("Push and insert", list.get_length() == 4 && list[0] == 0 && list[1] == 1 && list[2] == 2 && list[3] == 3);
+
+    // Test pop_back, pop_front and erase
+    list.pop_back();
+    list.pop_front();
+    list.erase(0);
+    print_test_result("Pop and erase", list.get_length() == 1 && list[0] == 2);
+
+    // Test indexed access against a reference sequence
+    std::vector<int> reference = {2};
+    for (int i = 0; i < 2000; ++i) {
+        const unsigned long long index = (static_cast<unsigned long long>(i) * 7919) % (reference.size() + 1);
+        list.insert(index, i);
+        reference.insert(reference.begin() + static_cast<long long>(index), i);
+    }
+    for (int i = 0; i < 500; ++i) {
+        const unsigned long long index = (static_cast<unsigned long long>(i) * 104729) % reference.size();
+        list.erase(index);
+        reference.erase(reference.begin() + static_cast<long long>(index));
+    }
+    bool indexed_ok = list.get_length() == reference.size();
+    for (unsigned long long i = 0; indexed_ok && i < reference.size(); ++i) {
+        indexed_ok = list[static_cast<long long>(i)] == reference[i];
+    }
+    print_test_result("Indexed access", indexed_ok);
+
+    // Test bidirectional iteration
+    Skip_List<int>::Iterator it = list.end();
+    --it;
+    bool iter_ok = *it == reference.back();
+    unsigned long long count = 0;
+    for (it = list.begin(); it != list.end(); ++it) {
+        iter_ok = iter_ok && *it == reference[count++];
+    }
+    print_test_result("Bidirectional iteration", iter_ok && count == reference.size());
+
+    // Test copy constructor and assignment operator
+    Skip_List<int> list2(list);
+    Skip_List<int> list3;
+    list3 = list;
+    print_test_result("Copy semantics", list2.get_length() == list.get_length() && list3[100] == list[100] && list2.get_probability() == 0.25);
+
+    // Test clear
+    list.clear();
+    print_test_result("Clear", list.empty() && list2.get_length() == reference.size());
+}
+
+/**
+ * @brief Comprehensive test suite for Unrolled Linked List implementation
+ * 
+ * Tests all major operations of the Unrolled_Linked_List class:
+ * - Constructor and initialization
+ * - Element insertion (push_back, push_front, insert) including node splits
+ * - Element deletion (pop_back, pop_front, erase) including node merges
+ * - Bidirectional iteration across node boundaries
+ * - Copy semantics (copy constructor, assignment operator)
+ * - Initializer list constructor
+ * 
+ * @note Uses a small node capacity so that splits and merges are exercised
+ * @see Unrolled_Linked_List
+ */
+void test_unrolled_linked_list() {
+    std::cout << "\nTesting Unrolled Linked List:" << std::endl;
+
+    // Test constructor and initial state
+    Unrolled_Linked_List<int, 4> list;
+    print_test_result("Empty list initialization", list.empty() && list.get_length() == 0);
+
+    // Test push_back across several nodes
+    for (int i = 0; i < 10; ++i) {
+        list.push_back(i);
+    }
+    print_test_result("Push back", list.get_length() == 10 && list[0] == 0 && list[9] == 9);
+
+    // Test push_front and insert into full nodes
+    list.push_front(-1);
+    list.insert(5, 100);
+    print_test_result("Push front and insert", list.get_length() == 12 && list[0] == -1 && list[5] == 100 && list[6] == 4);
+
+    // Test pop_back, pop_front and erase
+    list.pop_back();
+    list.pop_front();
+    list.erase(4);
+    list.erase(1);
+    print_test_result("Pop and erase", list.get_length() == 8 && list[0] == 0 && list[1] == 2 && list[7] == 8);
+
+    // Test bidirectional iteration
+    int sum = 0;
+    for (Unrolled_Linked_List<int, 4>::Iterator it = list.begin(); it != list.end(); ++it) {
+        sum += *it;
+    }
+    Unrolled_Linked_List<int, 4>::Iterator last = list.end();
+    --last;
+    print_test_result("Iteration", sum == 35 && *last == 8);
+
+    // Test initializer list constructor
+    Unrolled_Linked_List<int, 4> list2 = {1, 2, 3, 4, 5};
+    print_test_result("Initializer list constructor", list2.get_length() == 5 && list2[0] == 1 && list2[4] == 5);
+
+    // Test copy constructor
+    Unrolled_Linked_List<int, 4> list3(list);
+    print_test_result("Copy constructor", list3.get_length() == list.get_length() && list3[3] == list[3]);
+
+    // Test assignment operator
+    list2 = list;
+    print_test_result("Assignment operator", list2.get_length() == list.get_length() && list2[7] == list[7]);
+
+    // Test that removal releases what non-trivial elements hold
+    std::shared_ptr<int> shared_item = std::make_shared<int>(7);
+    Unrolled_Linked_List<std::shared_ptr<int>, 4> owners;
+    for (int i = 0; i < 3; ++i) {
+        owners.push_back(shared_item);
+    }
+    owners.pop_back();
+    owners.erase(owners.get_length() - 1);
+    print_test_result("Removal releases elements", shared_item.use_count() == 2 && owners.get_length() == 1);
+
+    // Test clear
+    list.clear();
+    print_test_result("Clear", list.empty() && list.get_length() == 0);
+}
+
+/**
+ * @brief Comprehensive test suite for Intrusive List implementation
+ * 
+ * Tests all major operations of the Intrusive_List class:
+ * - Constructor and initialization
+ * - Linking (push_back, push_front, insert) and unlinking (pop_back, pop_front, erase)
+ * - O(1) removal of an object through remove() and iterator_to()
+ * - Membership of one object in two lists through separate hooks
+ * - Hook state tracking (is_linked) and move semantics
+ * 
+ * @note Safe-mode misuse checks are only exercised when INTRUSIVE_LIST_SAFE_MODE is enabled
+ * @see Intrusive_List
+ */
+void test_intrusive_list() {
+    std::cout << "\nTesting Intrusive List:" << std::endl;
+
+    struct Task {
+        int id;
+        List_Hook by_queue;
+        List_Hook by_owner;
+    };
+    std::vector<Task> tasks(5);
+    for (int i = 0; i < 5; ++i) {
+        tasks[i].id = i;
+    }
+
+    // Test constructor and initial state
+    Intrusive_List<Task, &Task::by_queue> queue;
+    Intrusive_List<Task, &Task::by_owner> owned;
+    print_test_result("Empty list initialization", queue.empty() && queue.get_length() == 0 && queue.begin() == queue.end());
+
+    // Test push_back, push_front and insert
+    queue.push_back(tasks[1]);
+    queue.push_back(tasks[3]);
+    queue.push_front(tasks[0]);
+    queue.insert(queue.iterator_to(tasks[3]), tasks[2]);
+    print_test_result("Push and insert", queue.get_length() == 4 && queue.front_item().id == 0 && queue.back_item().id == 3 && tasks[2].by_queue.is_linked());
+
+    // Test membership in two lists at once
+    owned.push_back(tasks[3]);
+    owned.push_back(tasks[1]);
+    owned.push_back(tasks[4]);
+    int order = 0;
+    for (Intrusive_List<Task, &Task::by_queue>::Iterator it = queue.begin(); it != queue.end(); ++it) {
+        order = order * 10 + it->id;
+    }
+    print_test_result("Multiple memberships", order == 123 && owned.get_length() == 3 && owned.front_item().id == 3 && !tasks[4].by_queue.is_linked());
+
+    // Test O(1) removal from any position
+    queue.remove(tasks[1]);
+    Intrusive_List<Task, &Task::by_owner>::Iterator next = owned.erase(owned.iterator_to(tasks[3]));
+    print_test_result("Remove and erase", queue.get_length() == 3 && !tasks[1].by_queue.is_linked() && tasks[1].by_owner.is_linked() && next->id == 1 && owned.get_length() == 2);
+
+    // Test pop_back, pop_front and backward iteration
+    queue.pop_front();
+    Intrusive_List<Task, &Task::by_queue>::Iterator last = queue.end();
+    --last;
+    print_test_result("Pop and backward iteration", queue.get_length() == 2 && last->id == 3 && (*--last).id == 2 && !tasks[0].by_queue.is_linked());
+    queue.pop_back();
+
+#if INTRUSIVE_LIST_SAFE_MODE
+    // Test safe-mode hook checks
+    bool rejected = false;
+    try {
+        queue.push_back(tasks[2]);
+    } catch (const std::logic_error&) {
+        rejected = true;
+    }
+    Intrusive_List<Task, &Task::by_queue> other_queue;
+    other_queue.push_back(tasks[4]);
+    bool wrong_list = false;
+    try {
+        queue.remove(tasks[4]);
+    } catch (const std::logic_error&) {
+        wrong_list = true;
+    }
+    print_test_result("Safe mode hook checks", rejected && wrong_list && queue.get_length() == 1 &&
+                      other_queue.get_length() == 1 && tasks[4].by_queue.is_linked());
+    other_queue.clear();
+#endif
+
+    // Test move constructor and clear
+    Intrusive_List<Task, &Task::by_owner> moved(std::move(owned));
+    print_test_result("Move constructor", owned.empty() && moved.get_length() == 2 && moved.back_item().id == 4);
+    moved.clear();
+    queue.clear();
+    print_test_result("Clear", moved.empty() && !tasks[4].by_owner.is_linked() && !tasks[2].by_queue.is_linked());
+}
+
+/**
+ * @brief Comprehensive test suite for Linked Hash Set and Map implementations
+ * 
+ * Tests all major operations of the Linked_Hash_Set and Linked_Hash_Map classes:
+ * - Constructor and initialization (including initializer lists with duplicates)
+ * - Insertion and membership tests (insert, contains, find)
+ * - Removal by value, by iterator and from the front
+ * - Iteration in insertion order after removals and re-insertions
+ * - Map access (operator[], at) and copy semantics
+ * 
+ * @note All tests use integer and string data types for simplicity
+ * @see Linked_Hash_Set
+ * @see Linked_Hash_Map
+ */
+void test_linked_hash() {
+    std::cout << "\nTesting Linked Hash Set and Map:" << std::endl;
+
+    // Test constructor and initial state
+    Linked_Hash_Set<int> set;
+    print_test_result("Empty set initialization", set.empty() && set.get_length() == 0 && !set.contains(1));
+
+    // Test insert and contains
+    bool fresh = set.insert(5) && set.insert(1) && set.insert(9);
+    bool repeated = set.insert(1);
+    print_test_result("Insert and contains", fresh && !repeated && set.get_length() == 3 && set.contains(9) && set.find(4) == set.end());
+
+    // Test erase by value and insertion order
+    set.erase(1);
+    set.insert(1);
+    set.insert(7);
+    int order = 0;
+    for (Linked_Hash_Set<int>::Iterator it = set.begin(); it != set.end(); ++it) {
+        order = order * 10 + *it;
+    }
+    print_test_result("Erase and insertion order", order == 5917 && !set.erase(3));
+
+    // Test erase by iterator and pop_front
+    Linked_Hash_Set<int>::Iterator next = set.erase(set.find(9));
+    set.pop_front();
+    print_test_result("Erase iterator and pop front", *next == 1 && set.get_length() == 2 && set.front_item() == 1 && !set.contains(5));
+
+    // Test initializer list and copy semantics
+    Linked_Hash_Set<int> set2 = {3, 1, 3, 2, 1};
+    Linked_Hash_Set<int> set3(set2);
+    set3.insert(4);
+    set2 = set3;
+    print_test_result("Set copy semantics", set2.get_length() == 4 && set2.front_item() == 3 && set2.contains(4) && set3.get_length() == 4);
+
+    // Test map operator[], at and insertion order
+    Linked_Hash_Map<std::string, int> map = {{"one", 1}, {"two", 2}, {"one", 100}};
+    map["three"] = 3;
+    map["one"] += 10;
+    bool inserted = map.insert("four", 4) && !map.insert("two", 20);
+    std::string keys;
+    for (Linked_Hash_Map<std::string, int>::Iterator it = map.begin(); it != map.end(); ++it) {
+        keys += it->first + " ";
+    }
+    print_test_result("Map access and order", inserted && keys == "one two three four " && map.at("one") == 11 && map.at("two") == 2);
+
+    // Test map erase and at on a missing key
+    map.erase("two");
+    bool threw = false;
+    try {
+        map.at("two");
+    } catch (const std::out_of_range&) {
+        threw = true;
+    }
+    Linked_Hash_Map<std::string, int> map2(map);
+    map2.pop_front();
+    print_test_result("Map erase and copy", threw && map.get_length() == 3 && map2.get_length() == 2 && map2.front_item().first == "three" && map.contains("one"));
+
+    // Test clear
+    set.clear();
+    map.clear();
+    print_test_result("Clear", set.empty() && map.empty() && !map.contains("one"));
+}
+
+/**
+ * @brief Comprehensive test suite for LRU Cache implementation
+ * 
+ * Tests all major operations of the LRU_Cache and Sharded_LRU_Cache classes:
+ * - Constructor and initialization
+ * - Lookups (get, contains) and hit/miss counters
+ * - Least recently used eviction under a count budget
+ * - Charge-based (byte budget) eviction and capacity changes
+ * - Explicit removal (erase, evict, clear)
+ * - Sharded cache operations and aggregated counters
+ * 
+ * @note All tests use integer keys for simplicity
+ * @see LRU_Cache
+ * @see Sharded_LRU_Cache
+ */
+void test_lru_cache() {
+    std::cout << "\nTesting LRU Cache:" << std::endl;
+
+    // Test constructor and initial state
+    LRU_Cache<int, int> cache(3);
+    print_test_result("Empty cache initialization", cache.empty() && cache.get_size() == 0 && cache.get_capacity() == 3);
+
+    // Test put, get and counters
+    cache.put(1, 10);
+    cache.put(2, 20);
+    cache.put(3, 30);
+    int value = 0;
+    bool hit = cache.get(1, value);
+    bool miss = !cache.get(4, value);
+    print_test_result("Put and get", hit && miss && value == 10 && cache.get_hits() == 1 && cache.get_misses() == 1);
+
+    // Test least recently used eviction (2 is now the oldest entry)
+    cache.put(4, 40);
+    print_test_result("LRU eviction", cache.get_size() == 3 && !cache.contains(2) && cache.contains(1) && cache.get_evictions() == 1);
+
+    // Test replacing a value
+    cache.put(3, 33);
+    print_test_result("Replace value", cache.get(3, value) && value == 33 && cache.get_size() == 3);
+
+    // Test erase and evict
+    bool erased = cache.erase(1);
+    bool evicted = cache.evict();
+    print_test_result("Erase and evict", erased && evicted && cache.get_size() == 1 && cache.contains(3) && !cache.erase(1) && cache.get_evictions() == 2);
+
+    // Test charge-based eviction and capacity changes
+    LRU_Cache<int, int> sized(100);
+    sized.put(1, 1, 40);
+    sized.put(2, 2, 40);
+    sized.put(3, 3, 40);
+    bool byte_budget = sized.get_usage() == 80 && !sized.contains(1);
+    sized.put(4, 4, 101);
+    sized.set_capacity(50);
+    print_test_result("Charge budget", byte_budget && !sized.contains(4) && sized.get_size() == 1 && sized.get_usage() == 40 && sized.contains(3));
+
+    // Test clear
+    cache.clear();
+    print_test_result("Clear", cache.empty() && cache.get_usage() == 0 && !cache.contains(3));
+
+    // Test sharded cache
+    Sharded_LRU_Cache<int, int> sharded(64, 4);
+    for (int i = 0; i < 200; ++i) {
+        sharded.put(i, i * 2);
+    }
+    bool recent = sharded.get(199, value) && value == 398;
+    print_test_result("Sharded cache", recent && sharded.get_shard_count() == 4 && sharded.get_size() == 64 && sharded.get_evictions() == 136 && sharded.get_hits() == 1);
+}
+
+/**
+ * @brief Comprehensive test suite for Timing Wheel implementation
+ * 
+ * Tests all major operations of the Timing_Wheel class:
+ * - Constructor and initialization
+ * - Scheduling and firing at the exact tick
+ * - Cancellation through the timer id
+ * - Cascading of long delays through the wheel levels
+ * - Scheduling from inside an expiry callback
+ * 
+ * @note All tests use integer payloads for simplicity
+ * @see Timing_Wheel
+ */
+void test_timing_wheel() {
+    std::cout << "\nTesting Timing Wheel:" << std::endl;
+
+    // Test constructor and initial state
+    Timing_Wheel<int> wheel;
+    print_test_result("Empty wheel initialization", wheel.empty() && wheel.get_now() == 0 && wheel.get_pending() == 0);
+
+    // Test schedule and fire at the exact tick
+    unsigned long long first = wheel.schedule(3, 3);
+    wheel.schedule(5, 5);
+    wheel.schedule(0, 1);
+    bool exact = true;
+    unsigned long long fired = wheel.advance(5, [&wheel, &exact](int& payload) {
+        exact = exact && static_cast<unsigned long long>(payload) == wheel.get_now();
+    });
+    print_test_result("Schedule and fire", fired == 3 && exact && wheel.empty() && !wheel.is_pending(first));
+
+    // Test cancel
+    unsigned long long kept = wheel.schedule(10, 15);
+    unsigned long long dropped = wheel.schedule(10, -1);
+    bool cancelled = wheel.cancel(dropped) && !wheel.cancel(dropped);
+    int sum = 0;
+    wheel.advance(10, [&sum](int& payload) { sum += payload; });
+    print_test_result("Cancel", cancelled && sum == 15 && !wheel.is_pending(kept));
+
+    // Test cascading through higher levels
+    const unsigned long long delays[] = {255, 256, 65535, 65536, 70000, 16777300};
+    for (unsigned long long delay : delays) {
+        wheel.schedule(delay, static_cast<int>(delay));
+    }
+    bool on_time = true;
+    unsigned long long start = wheel.get_now();
+    fired = wheel.advance(16777300, [&wheel, &on_time, start](int& payload) {
+        on_time = on_time && wheel.get_now() - start == static_cast<unsigned long long>(payload);
+    });
+    print_test_result("Cascading", fired == 6 && on_time && wheel.empty() && wheel.get_now() == start + 16777300);
+
+    // Test scheduling from a callback
+    int chain = 0;
+    wheel.schedule(1, 0);
+    wheel.advance(20, [&wheel, &chain](int& payload) {
+        ++chain;
+        if (payload < 4) {
+            wheel.schedule(1, payload + 1);
+        }
+    });
+    print_test_result("Schedule from callback", chain == 5 && wheel.empty());
+}
+
 /**
  * @brief Displays the interactive menu for data structure testing
  * 
  * Presents a numbered menu with all available test options:
- * - Individual data structure tests (options 1-8)
+ * - Individual data structure tests (options 1-8 and 10 onwards)
  * - Run all tests option (option 9)
  * - Exit option (option 0)
  * 
@@ -548,6 +1451,12 @@ void print_menu() {
     std::cout << "7. Test Linked Queue" << std::endl;
     std::cout << "8. Test Binary Tree" << std::endl;
     std::cout << "9. Run All Tests" << std::endl;
+    std::cout << "10. Test Skip List" << std::endl;
+    std::cout << "11. Test Unrolled Linked List" << std::endl;
+    std::cout << "12. Test Intrusive List" << std::endl;
+    std::cout << "13. Test LRU Cache" << std::endl;
+    std::cout << "14. Test Linked Hash Set and Map" << std::endl;
+    std::cout << "15. Test Timing Wheel" << std::endl;
     std::cout << "0. Exit" << std::endl;
     std::cout << "Enter your choice: ";
 }
@@ -612,8 +1521,32 @@ int main() {
                 test_array_queue();
                 test_linked_queue();
                 test_binary_tree();
+                test_skip_list();
+                test_unrolled_linked_list();
+                test_intrusive_list();
+                test_lru_cache();
+                test_linked_hash();
+                test_timing_wheel();
                 std::cout << "\nAll tests completed!" << std::endl;
                 break;
+            case 10:
+                test_skip_list();
+                break;
+            case 11:
+                test_unrolled_linked_list();
+                break;
+            case 12:
+                test_intrusive_list();
+                break;
+            case 13:
+                test_lru_cache();
+                break;
+            case 14:
+                test_linked_hash();
+                break;
+            case 15:
+                test_timing_wheel();
+                break;
             case 0:
                 std::cout << "Exiting..." << std::endl;
                 break;